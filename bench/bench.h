@@ -0,0 +1,82 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.h                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:02:11 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 15:02:11 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef BENCH_H
+# define BENCH_H
+
+# include <time.h>
+# include <sys/resource.h>
+# include "../includes/minishell.h"
+
+# define BENCH_LEX 0
+# define BENCH_SUBSTI 1
+# define BENCH_DOLLAR 2
+# define BENCH_VALIDATE 3
+# define BENCH_CONVERT 4
+# define BENCH_PIPELINE 5
+# define BENCH_STAGES 6
+# define BENCH_PARSE_CORPUS "bench/corpus_parse.txt"
+# define BENCH_EXEC_CORPUS "bench/corpus_exec.txt"
+# define BENCH_PARSE_ROUNDS 2000
+# define BENCH_EXEC_ROUNDS 20
+
+typedef struct s_corpus
+{
+	char	**lines;
+	int		count;
+	int		capacity;
+}			t_corpus;
+
+typedef struct s_bench_stage
+{
+	char		*name;
+	long long	ns;
+	long		allocs;
+	long		lines;
+}				t_bench_stage;
+
+typedef struct s_bench
+{
+	t_shell			shell;
+	t_corpus		parse;
+	t_corpus		exec;
+	int				parse_rounds;
+	int				exec_rounds;
+	t_bench_stage	stages[BENCH_STAGES];
+	long long		mark_ns;
+	long			mark_allocs;
+}					t_bench;
+
+/* bench_alloc.c */
+void	*__real_malloc(size_t size);
+void	*__wrap_malloc(size_t size);
+long	bench_alloc_count(void);
+
+/* bench_corpus.c */
+int		corpus_load(t_corpus *corpus, char *path);
+void	corpus_destroy(t_corpus *corpus);
+
+/* bench_stage.c */
+void	bench_stages_init(t_bench *bench);
+void	bench_begin(t_bench *bench);
+void	bench_end(t_bench *bench, int stage);
+
+/* bench_parse.c */
+void	bench_parse(t_bench *bench);
+
+/* bench_exec.c */
+int		bench_exec(t_bench *bench);
+
+/* bench_report.c */
+void	bench_report(t_bench *bench);
+
+#endif
@@ -0,0 +1,31 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_alloc.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:04:37 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 15:04:37 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+static long	*alloc_counter(void)
+{
+	static long	count = 0;
+
+	return (&count);
+}
+
+void	*__wrap_malloc(size_t size)
+{
+	(*alloc_counter())++;
+	return (__real_malloc(size));
+}
+
+long	bench_alloc_count(void)
+{
+	return (*alloc_counter());
+}
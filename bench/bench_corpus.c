@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_corpus.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:06:52 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 15:06:52 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+static int	corpus_push(t_corpus *corpus, char *line)
+{
+	char	**grown;
+
+	if (corpus->count == corpus->capacity)
+	{
+		corpus->capacity = corpus->capacity * 2 + 16;
+		grown = malloc(sizeof(char *) * corpus->capacity);
+		if (!grown)
+			return (-1);
+		ft_memcpy(grown, corpus->lines, sizeof(char *) * corpus->count);
+		free(corpus->lines);
+		corpus->lines = grown;
+	}
+	corpus->lines[corpus->count] = line;
+	corpus->count++;
+	return (0);
+}
+
+static int	is_corpus_line(char *line)
+{
+	return (line[0] != '#' && is_not_only_whitespace(line) == 0);
+}
+
+int	corpus_load(t_corpus *corpus, char *path)
+{
+	t_reader	reader;
+	char		*line;
+	int			fd;
+
+	corpus->lines = NULL;
+	corpus->count = 0;
+	corpus->capacity = 0;
+	fd = open(path, O_RDONLY);
+	if (fd == -1 || reader_init(&reader, fd, NULL) == -1)
+	{
+		print_error(path, strerror(errno));
+		return (-1);
+	}
+	line = reader_next_line(&reader);
+	while (line)
+	{
+		if (!is_corpus_line(line) || corpus_push(corpus, line) == -1)
+			free(line);
+		line = reader_next_line(&reader);
+	}
+	reader_destroy(&reader);
+	return (0);
+}
+
+void	corpus_destroy(t_corpus *corpus)
+{
+	while (corpus->count > 0)
+	{
+		corpus->count--;
+		free(corpus->lines[corpus->count]);
+	}
+	free(corpus->lines);
+	corpus->lines = NULL;
+}
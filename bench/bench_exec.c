@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_exec.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:17:05 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 15:17:05 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+static void	exec_corpus(t_bench *bench)
+{
+	int	round;
+	int	i;
+
+	round = 0;
+	while (round < bench->exec_rounds)
+	{
+		i = 0;
+		while (i < bench->exec.count)
+		{
+			bench_begin(bench);
+			process_line(bench->exec.lines[i], &bench->shell);
+			bench_end(bench, BENCH_PIPELINE);
+			i++;
+		}
+		round++;
+	}
+}
+
+int	bench_exec(t_bench *bench)
+{
+	int	saved_stdout;
+	int	null_fd;
+
+	null_fd = open("/dev/null", O_WRONLY);
+	saved_stdout = dup(STDOUT_FILENO);
+	if (null_fd == -1 || saved_stdout == -1)
+	{
+		perror("minishell_bench");
+		return (-1);
+	}
+	dup2(null_fd, STDOUT_FILENO);
+	close(null_fd);
+	exec_corpus(bench);
+	dup2(saved_stdout, STDOUT_FILENO);
+	close(saved_stdout);
+	return (0);
+}
@@ -0,0 +1,64 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_main.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:23:14 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 15:23:14 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+volatile sig_atomic_t	g_signal_received = 0;
+
+static int	parse_rounds(char *arg, int fallback)
+{
+	int	rounds;
+
+	if (!arg)
+		return (fallback);
+	rounds = ft_atoi(arg);
+	if (rounds <= 0)
+		return (fallback);
+	return (rounds);
+}
+
+static void	bench_init(t_bench *bench, int argc, char **argv)
+{
+	bench->parse_rounds = BENCH_PARSE_ROUNDS;
+	bench->exec_rounds = BENCH_EXEC_ROUNDS;
+	if (argc > 3)
+		bench->parse_rounds = parse_rounds(argv[3], BENCH_PARSE_ROUNDS);
+	if (argc > 4)
+		bench->exec_rounds = parse_rounds(argv[4], BENCH_EXEC_ROUNDS);
+	bench_stages_init(bench);
+}
+
+int	main(int argc, char **argv, char **envp)
+{
+	t_bench	bench;
+	char	*parse_path;
+	char	*exec_path;
+
+	parse_path = BENCH_PARSE_CORPUS;
+	exec_path = BENCH_EXEC_CORPUS;
+	if (argc > 1)
+		parse_path = argv[1];
+	if (argc > 2)
+		exec_path = argv[2];
+	bench_init(&bench, argc, argv);
+	init_shell(&bench.shell, envp);
+	if (corpus_load(&bench.parse, parse_path) == -1
+		|| corpus_load(&bench.exec, exec_path) == -1)
+		return (1);
+	bench_parse(&bench);
+	bench_exec(&bench);
+	bench_report(&bench);
+	corpus_destroy(&bench.parse);
+	corpus_destroy(&bench.exec);
+	cleanup_shell(&bench.shell);
+	return (0);
+}
@@ -0,0 +1,72 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_parse.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:13:48 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 15:13:48 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+static int	parse_front(t_bench *bench, char *line, t_input **head)
+{
+	int	result;
+
+	bench_begin(bench);
+	*head = cy1_make_list(line);
+	bench_end(bench, BENCH_LEX);
+	if (!*head || ((*head)->type == 1 && !(*head)->next))
+		return (1);
+	bench_begin(bench);
+	result = cy3_substi_check(head);
+	bench_end(bench, BENCH_SUBSTI);
+	if (result)
+		return (1);
+	bench_begin(bench);
+	result = cy3_scan_dollar_syntax(*head, bench->shell.env,
+			bench->shell.last_exit_status, bench->shell.last_bg_pid);
+	bench_end(bench, BENCH_DOLLAR);
+	return (result);
+}
+
+static int	parse_back(t_bench *bench, t_input *head)
+{
+	t_cmd	*cmd;
+	int		result;
+
+	bench_begin(bench);
+	cy1_remove_space_nodes(&head);
+	result = validate_syntax(head);
+	bench_end(bench, BENCH_VALIDATE);
+	if (result)
+		return (1);
+	bench_begin(bench);
+	cmd = cy2_convert_cmd(head);
+	bench_end(bench, BENCH_CONVERT);
+	return (cmd == NULL);
+}
+
+void	bench_parse(t_bench *bench)
+{
+	t_input	*head;
+	int		round;
+	int		i;
+
+	round = 0;
+	while (round < bench->parse_rounds)
+	{
+		i = 0;
+		while (i < bench->parse.count)
+		{
+			if (!parse_front(bench, bench->parse.lines[i], &head))
+				parse_back(bench, head);
+			cy_arena_reset();
+			i++;
+		}
+		round++;
+	}
+}
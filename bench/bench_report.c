@@ -0,0 +1,49 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_report.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:20:31 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 15:20:31 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+static void	report_stage(t_bench_stage *stage)
+{
+	double	lines;
+
+	if (stage->lines == 0)
+	{
+		printf("%-10s %12s %12s %10d\n", stage->name, "-", "-", 0);
+		return ;
+	}
+	lines = (double)stage->lines;
+	printf("%-10s %12.1f %12.2f %10ld\n", stage->name,
+		(double)stage->ns / lines, (double)stage->allocs / lines,
+		stage->lines);
+}
+
+void	bench_report(t_bench *bench)
+{
+	struct rusage	usage;
+	int				i;
+
+	printf("parse corpus: %d lines x %d rounds\n", bench->parse.count,
+		bench->parse_rounds);
+	printf("exec corpus:  %d lines x %d rounds\n\n", bench->exec.count,
+		bench->exec_rounds);
+	printf("%-10s %12s %12s %10s\n", "stage", "ns/line", "allocs/line",
+		"lines");
+	i = 0;
+	while (i < BENCH_STAGES)
+	{
+		report_stage(&bench->stages[i]);
+		i++;
+	}
+	getrusage(RUSAGE_SELF, &usage);
+	printf("\npeak rss: %ld kB\n", usage.ru_maxrss);
+}
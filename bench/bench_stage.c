@@ -0,0 +1,54 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench_stage.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:09:20 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 15:09:20 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "bench.h"
+
+static long long	bench_now(void)
+{
+	struct timespec	ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ((long long)ts.tv_sec * 1000000000LL + ts.tv_nsec);
+}
+
+void	bench_stages_init(t_bench *bench)
+{
+	static char	*names[BENCH_STAGES] = {"lex", "substi", "dollar",
+		"validate", "convert", "pipeline"};
+	int			i;
+
+	i = 0;
+	while (i < BENCH_STAGES)
+	{
+		bench->stages[i].name = names[i];
+		bench->stages[i].ns = 0;
+		bench->stages[i].allocs = 0;
+		bench->stages[i].lines = 0;
+		i++;
+	}
+}
+
+void	bench_begin(t_bench *bench)
+{
+	bench->mark_allocs = bench_alloc_count();
+	bench->mark_ns = bench_now();
+}
+
+void	bench_end(t_bench *bench, int stage)
+{
+	long long	now;
+
+	now = bench_now();
+	bench->stages[stage].ns += now - bench->mark_ns;
+	bench->stages[stage].allocs += bench_alloc_count() - bench->mark_allocs;
+	bench->stages[stage].lines++;
+}
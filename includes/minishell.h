@@ -1,228 +1,579 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   minishell.h                                        :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:43:23 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:43:23 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#ifndef MINISHELL_H
-# define MINISHELL_H
-
-# include <stdlib.h>
-# include <unistd.h>
-# include <stdio.h>
-# include <string.h>
-# include <sys/wait.h>
-# include <sys/stat.h>
-# include <signal.h>
-# include <fcntl.h>
-# include <errno.h>
-# include <readline/readline.h>
-# include <readline/history.h>
-# include "../parser/prser.h"
-# define PROMPT "minishell$ "
-# define ERROR_CMD_NOT_FOUND 127
-# define ERROR_PERMISSION 126
-# define ERROR_SYNTAX 2
-# define ERROR_MALLOC 1
-
-extern volatile sig_atomic_t	g_signal_received;
-
-typedef struct s_shell
-{
-	char	**env;
-	int		last_exit_status;
-	int		in_pipe;
-	int		in_child;
-	pid_t	current_child_pid;
-	int		should_exit;
-}			t_shell;
-
-typedef struct s_exec
-{
-	int		pipe_fd[2];
-	int		prev_pipe;
-	pid_t	pid;
-	int		status;
-}			t_exec;
-
-typedef struct s_pipeline_data
-{
-	pid_t	*pids;
-	int		index;
-}	t_pipeline_data;
-
-/* main.c */
-void			shell_loop(t_shell *shell);
-void			init_shell(t_shell *shell, char **envp);
-void			cleanup_shell(t_shell *shell);
-
-/* input/input_validation.c */
-int				is_not_only_whitespace(const char *s);
-int				validate_syntax(t_input *head_input);
-void			handle_signal_interrupt(t_shell *shell, char *line);
-
-/* input/input_processing.c */
-int				parse_and_validate_input(t_input **head_input, char *line,
-					t_shell *shell);
-int				validate_and_convert_syntax(t_input *head_input,
-					t_cmd **head_cmd, t_shell *shell);
-void			process_line(char *line, t_shell *shell);
-void			process_input_line(char *line, t_shell *shell);
-
-/* executor/executor.c */
-int				execute_simple_command(t_cmd *cmd, t_shell *shell);
-int				execute_command_line(t_cmd *cmd_list, t_shell *shell);
-
-/* executor/executor_builtins.c */
-int				is_builtin(char *cmd);
-int				execute_builtin(t_cmd *cmd, t_shell *shell);
-int				must_run_in_parent(char *cmd);
-int				execute_builtin_with_redirs(t_cmd *cmd, t_shell *shell);
-
-/* executor/pipes_basic.c */
-int				create_pipe(int pipe_fd[2]);
-void			setup_pipe_child(int pipe_fd[2], int prev_pipe, int is_last);
-void			close_pipe_parent(int pipe_fd[2], int *prev_pipe);
-
-/* executor/heredoc.c */
-int				preprocess_heredocs(t_cmd *cmd_list);
-
-/* executor/command_execution.c */
-int				execute_and_manage_pipes(t_cmd *current, t_shell *shell,
-					t_exec *exec, t_pipeline_data *data);
-
-/* executor/pipeline.c */
-int				execute_pipeline(t_cmd *cmd_list, t_shell *shell);
-
-/* executor/redirections.c */
-int				setup_redirections(t_redir *redirs);
-int				open_file_for_redirect(char *filename, int type);
-int				handle_heredoc(char *delimiter);
-
-/* executor/redirection_utils.c */
-int				handle_heredoc_interruption(int pipe_fd[2]);
-int				process_heredoc_line(char *line, char *delimiter,
-					int pipe_fd[2]);
-int				read_heredoc_loop(char *delimiter, int pipe_fd[2]);
-int				execute_redirections_only(t_cmd *cmd);
-
-/* executor/path.c */
-char			*find_command_path(char *cmd, char **env);
-char			**get_paths_from_env(char **env);
-char			*check_path(char *dir, char *cmd);
-
-/* executor/path_search.c */
-char			*search_in_path(char *cmd, char **env);
-
-/* executor/path_expansion.c */
-char			**expand_args_tildes(char **args, char **env);
-char			*expand_single_tilde(char *arg, char **env);
-
-/* builtins/echo.c */
-int				builtin_echo(char **args);
-
-/* builtins/cd.c */
-int				builtin_cd(char **args, char ***env);
-
-/* builtins/cd_path.c */
-char			*normalize_path_segments(char *path);
-char			*normalize_path(char *path, char **env);
-
-/* builtins/cd_utils.c */
-int				calculate_total_length(char **stack, int count);
-void			build_path_string(char **stack, int count,
-					char *result, int absolute);
-char			*rebuild_path(char **stack, int count, int absolute);
-
-/* builtins/pwd.c */
-int				builtin_pwd(void);
-
-/* builtins/export.c */
-int				builtin_export(char **args, char ***env);
-
-/* builtins/export_display.c */
-void			print_sorted_env(char **env);
-void			print_export_error(char *arg);
-
-/* builtins/unset.c */
-int				builtin_unset(char **args, char ***env);
-
-/* builtins/env.c */
-int				builtin_env(char **env);
-
-/* builtins/exit.c */
-int				builtin_exit(char **args, t_shell *shell);
-
-/* signals/signals.c */
-void			handle_sigusr1(int sig);
-void			setup_signals(void);
-void			setup_child_signals(void);
-void			handle_sigint(int sig);
-void			handle_sigquit(int sig);
-int				check_signals_hook(void);
-
-/* signals/signal_heredoc.c */
-void			handle_sigint_heredoc(int sig);
-void			setup_heredoc_signals(void);
-
-/* environment/env_core.c */
-char			**copy_env(char **envp);
-void			free_env(char **env);
-char			*get_env_value(char **env, char *key);
-char			**realloc_env(char **env, int new_size);
-int				find_env_index(char **env, char *key);
-
-/* environment/env_modify.c */
-int				set_env_value(char ***env, char *key, char *value);
-int				unset_env_value(char ***env, char *key);
-
-/* memory/array_utils.c */
-void			free_string_array(char **array);
-int				count_string_array(char **array);
-char			**duplicate_string_array(char **array);
-
-/* memory/cleanup.c */
-void			error_exit(char *msg, int exit_code);
-void			print_error(char *cmd, char *msg);
-
-/* string/string_basic.c */
-int				ft_strcmp(const char *s1, const char *s2);
-int				ft_strncmp(const char *s1, const char *s2, size_t n);
-size_t			ft_strlen(const char *s);
-char			*ft_strchr(const char *s, int c);
-int				ft_isdigit(int c);
-
-/* string/string_copy.c */
-char			*ft_strdup(const char *s);
-char			*ft_strjoin(char const *s1, char const *s2);
-char			*ft_strcpy(char *dst, const char *src);
-char			*ft_strcat(char *dst, const char *src);
-char			*ft_strncpy(char *dst, const char *src, size_t n);
-
-/* string/ft_strstr.c */
-char			*ft_strstr(const char *haystack, const char *needle);
-
-/* string/ft_atoi.c */
-int				ft_atoi(const char *str);
-
-/* string/ft_itoa.c */
-char			*ft_itoa(int n);
-
-/* string/ft_split_utils.c */
-int				count_words(char const *s, char c);
-int				get_word_len(char const *s, char c);
-void			free_split(char **array, int i);
-char			*extract_word(char const *s, int len);
-char			**allocate_split_array(char const *s, char c);
-
-/* string/ft_split.c */
-int				fill_split_array(char **array, char const *s, char c);
-char			**ft_split(char const *s, char c);
-
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   minishell.h                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:43:23 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:43:23 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef MINISHELL_H
+# define MINISHELL_H
+
+# ifndef _GNU_SOURCE
+#  define _GNU_SOURCE
+# endif
+# include <stdlib.h>
+# include <unistd.h>
+# include <stdio.h>
+# include <string.h>
+# include <sys/wait.h>
+# include <sys/stat.h>
+# include <signal.h>
+# include <fcntl.h>
+# include <errno.h>
+# include <spawn.h>
+# include <limits.h>
+# include <sys/mman.h>
+# include <sys/resource.h>
+# include <sys/signalfd.h>
+# include <sys/uio.h>
+# include <readline/readline.h>
+# include <readline/history.h>
+# include "../parser/prser.h"
+# define PROMPT "minishell$ "
+# define ERROR_CMD_NOT_FOUND 127
+# define ERROR_PERMISSION 126
+# define ERROR_SYNTAX 2
+# define ERROR_MALLOC 1
+# define CMD_HASH_SIZE 64
+# define READER_BUFFER_SIZE 65536
+# define OUT_IOV_MAX 64
+# define OUT_BUFFER_SIZE 4096
+# define JOB_DONE_SIZE 16
+# define PARSE_CACHE_SIZE 64
+# define PARSE_CACHE_BLOCK 1024
+# define HISTORY_FILE "/.minishell_history"
+# define HISTORY_SIZE 1000
+# define HISTORY_INDEX_SIZE 4096
+
+extern volatile sig_atomic_t	g_signal_received;
+
+typedef struct s_hash_entry
+{
+	char				*name;
+	char				*path;
+	int					hits;
+	struct s_hash_entry	*next;
+}	t_hash_entry;
+
+typedef struct s_cmd_hash
+{
+	t_hash_entry	*buckets[CMD_HASH_SIZE];
+	int				path_gen;
+}	t_cmd_hash;
+
+struct s_env
+{
+	char	**vars;
+	int		count;
+	int		live;
+	int		capacity;
+	int		*table;
+	int		table_size;
+	int		table_used;
+	char	**envp;
+	int		envp_gen;
+	int		generation;
+	int		path_gen;
+};
+
+typedef struct s_reader
+{
+	int		fd;
+	char	*buf;
+	size_t	len;
+	size_t	pos;
+	size_t	scan;
+	size_t	cap;
+	int		eof;
+}			t_reader;
+
+typedef struct s_out
+{
+	int				fd;
+	int				count;
+	size_t			used;
+	struct iovec	iov[OUT_IOV_MAX];
+	char			buf[OUT_BUFFER_SIZE];
+}					t_out;
+
+typedef struct s_heredoc
+{
+	char	*data;
+	size_t	len;
+	size_t	cap;
+}			t_heredoc;
+
+typedef struct s_job_proc
+{
+	pid_t			pid;
+	int				status;
+	int				done;
+	struct rusage	usage;
+}					t_job_proc;
+
+typedef struct s_job
+{
+	int				id;
+	int				count;
+	int				live;
+	int				background;
+	t_job_proc		*procs;
+	struct s_job	*next;
+}					t_job;
+
+typedef struct s_job_table
+{
+	t_job	*head;
+	int		next_id;
+	int		sigfd;
+	pid_t	done_pid[JOB_DONE_SIZE];
+	int		done_job[JOB_DONE_SIZE];
+	int		done_status[JOB_DONE_SIZE];
+	int		done_next;
+}			t_job_table;
+
+typedef struct s_cache_word
+{
+	char	*input;
+	t_span	*spans;
+	int		nspans;
+	int		redir;
+}			t_cache_word;
+
+typedef struct s_cache_cmd
+{
+	t_cache_word		*words;
+	int					argc;
+	int					nredir;
+	struct s_cache_cmd	*next;
+}						t_cache_cmd;
+
+typedef struct s_cache_entry
+{
+	char					*line;
+	unsigned int			hash;
+	t_cache_cmd				*cmds;
+	t_arena_block			*mem;
+	struct s_cache_entry	*prev;
+	struct s_cache_entry	*next;
+}							t_cache_entry;
+
+typedef struct s_parse_cache
+{
+	t_cache_entry	*head;
+	t_cache_entry	*tail;
+	int				count;
+	t_input			**nodes;
+	t_cache_word	*raw;
+	int				nnodes;
+}					t_parse_cache;
+
+typedef struct s_trigram
+{
+	unsigned int		key;
+	int					*ids;
+	int					count;
+	int					cap;
+	struct s_trigram	*next;
+}						t_trigram;
+
+typedef struct s_hist_index
+{
+	char		**lines;
+	int			count;
+	int			cap;
+	int			base;
+	t_trigram	**buckets;
+}				t_hist_index;
+
+typedef struct s_history
+{
+	char			*path;
+	int				fd;
+	int				max;
+	int				lines;
+	t_hist_index	index;
+	char			*query;
+	int				match;
+}					t_history;
+
+typedef struct s_shell
+{
+	t_env			*env;
+	int				last_exit_status;
+	int				in_pipe;
+	int				in_child;
+	pid_t			current_child_pid;
+	int				should_exit;
+	int				background;
+	pid_t			last_bg_pid;
+	t_cmd_hash		cmd_hash;
+	t_job_table		jobs;
+	t_parse_cache	parse_cache;
+	t_history		history;
+}					t_shell;
+
+typedef struct s_background
+{
+	struct sigaction	sigint;
+	struct sigaction	sigquit;
+	int					saved_stdin;
+}						t_background;
+
+typedef struct s_exec
+{
+	int		pipe_fd[2];
+	int		prev_pipe;
+	pid_t	pid;
+	int		status;
+}			t_exec;
+
+typedef struct s_stage
+{
+	int		fds[2];
+	char	*path;
+	char	**args;
+	int		status;
+	pid_t	pid;
+}	t_stage;
+
+typedef struct s_pipeline_data
+{
+	t_stage	*stages;
+	int		index;
+}	t_pipeline_data;
+
+/* main.c */
+void			shell_loop(t_shell *shell);
+
+/* input/input_validation.c */
+int				is_not_only_whitespace(const char *s);
+void			print_syntax_error(t_syntax *err);
+int				validate_syntax(t_input *head_input);
+void			handle_signal_interrupt(t_shell *shell, char *line);
+
+/* input/input_processing.c */
+int				prepare_pipeline(t_cmd_list *node, t_shell *shell);
+int				validate_and_convert_syntax(t_input *head_input,
+					t_cmd **head_cmd, t_shell *shell);
+void			process_line(char *line, t_shell *shell);
+void			process_input_line(char *line, t_shell *shell);
+
+/* input/history.c */
+void			history_reset(t_history *hist);
+void			history_init(t_history *hist, t_env *env);
+void			history_add(t_history *hist, char *line);
+void			history_close(t_history *hist);
+
+/* input/history_file.c */
+void			history_map(t_history *hist, int replay);
+
+/* input/history_index.c */
+int				hist_index_add(t_hist_index *idx, char *line);
+void			hist_index_trim(t_hist_index *idx, int keep);
+void			hist_index_clear(t_hist_index *idx);
+
+/* input/history_trigram.c */
+unsigned int	hist_trigram(const char *s, unsigned int *slot);
+t_trigram		*hist_index_lookup(t_hist_index *idx, const char *s);
+t_trigram		*hist_posting_get(t_hist_index *idx, const char *s);
+int				hist_posting_push(t_trigram *node, int id);
+
+/* input/history_search.c */
+int				hist_index_search(t_hist_index *idx, char *query, int before);
+
+/* input/history_key.c */
+void			history_bind(t_history *hist);
+
+/* input/parse_cache.c */
+void			*parse_cache_alloc(t_cache_entry *entry, size_t size);
+void			parse_cache_free(t_cache_entry *entry);
+t_cache_entry	*parse_cache_find(t_parse_cache *cache, char *line);
+void			parse_cache_insert(t_parse_cache *cache, t_cache_entry *entry);
+
+/* input/parse_cache_record.c */
+void			parse_cache_record(t_parse_cache *cache, char *line,
+					t_cmd *cmds);
+
+/* input/parse_cache_replay.c */
+int				parse_cache_replay(t_parse_cache *cache, char *line,
+					t_shell *shell, t_cmd_list **list);
+
+/* input/parse_cache_line.c */
+unsigned int	parse_cache_hash(char *line);
+int				parse_cache_plain(char *word);
+void			parse_cache_snapshot(t_parse_cache *cache, t_input *head);
+void			parse_cache_clear(t_parse_cache *cache);
+void			parse_cache_commit(t_parse_cache *cache, char *line,
+					t_cmd *cmds);
+
+/* input/command_line.c */
+int				parse_command_line(char *line, t_shell *shell,
+					t_cmd_list **list);
+
+/* input/input_source.c */
+void			set_input_reader(t_reader *reader);
+int				is_batch_input(void);
+char			*read_input_line(char *prompt);
+
+/* input/reader.c */
+int				reader_init(t_reader *reader, int fd, char *text);
+char			*reader_next_line(t_reader *reader);
+void			reader_destroy(t_reader *reader);
+
+/* input/batch.c */
+int				run_batch(t_shell *shell, int argc, char **argv);
+
+/* executor/executor.c */
+int				execute_simple_command(t_cmd *cmd, t_shell *shell);
+int				execute_command_line(t_cmd *cmd_list, t_shell *shell);
+
+/* executor/command_list.c */
+int				execute_list(t_cmd_list *list, t_shell *shell);
+
+/* executor/background.c */
+int				execute_background(t_cmd *cmd_list, t_shell *shell);
+
+/* executor/executor_builtins.c */
+int				is_builtin(char *cmd);
+int				execute_builtin(t_cmd *cmd, t_shell *shell);
+int				must_run_in_parent(char *cmd);
+int				execute_builtin_with_redirs(t_cmd *cmd, t_shell *shell);
+
+/* executor/pipes_basic.c */
+int				create_pipe(int pipe_fd[2]);
+void			setup_pipe_child(int pipe_fd[2], int prev_pipe, int is_last);
+void			close_pipe_parent(int pipe_fd[2], int *prev_pipe);
+
+/* executor/spawn.c */
+int				open_redirections(t_redir *redirs, int fds[2]);
+pid_t			spawn_command(char *cmd_path, char **args, t_shell *shell,
+					int fds[2]);
+
+/* executor/spawn_launch.c */
+void			close_fd_pair(int fds[2]);
+pid_t			start_external(t_stage *stage, t_shell *shell, int std_fds[2]);
+pid_t			spawn_simple_command(t_cmd *cmd, t_shell *shell, int *status);
+
+/* executor/stage.c */
+void			prepare_stages(t_cmd *cmd_list, t_shell *shell,
+					t_stage *stages);
+void			release_stages(t_stage *stages, int count);
+
+/* executor/heredoc.c */
+int				preprocess_heredocs(t_cmd *cmd_list);
+void			close_heredocs(t_cmd *cmd_list);
+
+/* executor/heredoc_store.c */
+int				open_memory_file(void);
+int				heredoc_store(char *data, size_t len);
+
+/* executor/command_execution.c */
+int				execute_and_manage_pipes(t_cmd *current, t_shell *shell,
+					t_exec *exec, t_pipeline_data *data);
+
+/* executor/stage_builtin.c */
+int				is_output_builtin(t_cmd *cmd);
+int				run_builtin_stage(t_cmd *cmd, t_shell *shell, t_exec *exec,
+					t_pipeline_data *data);
+
+/* executor/pipeline.c */
+int				execute_pipeline(t_cmd *cmd_list, t_shell *shell);
+
+/* executor/redirections.c */
+int				setup_redirections(t_redir *redirs);
+int				open_file_for_redirect(char *filename, int type);
+
+/* executor/redirection_utils.c */
+int				execute_redirections_only(t_cmd *cmd);
+
+/* executor/path.c */
+int				is_executable(char *path);
+char			*find_command_path(char *cmd, t_env *env);
+char			**get_paths_from_env(t_env *env);
+char			*check_path(char *dir, char *cmd);
+
+/* executor/path_search.c */
+char			*search_in_path(char *cmd, t_env *env);
+char			*resolve_command(char *cmd, t_shell *shell);
+
+/* executor/command_hash.c */
+void			hash_init(t_cmd_hash *table);
+t_hash_entry	*hash_find(t_cmd_hash *table, char *name);
+t_hash_entry	*hash_insert(t_cmd_hash *table, char *name, char *path);
+void			hash_remove(t_cmd_hash *table, char *name);
+
+/* executor/command_hash_utils.c */
+void			hash_clear(t_cmd_hash *table);
+void			hash_sync_path(t_cmd_hash *table, t_env *env);
+
+/* executor/path_expansion.c */
+char			**expand_args_tildes(char **args, t_env *env);
+char			*expand_single_tilde(char *arg, t_env *env);
+
+/* builtins/echo.c */
+int				builtin_echo(char **args);
+
+/* builtins/cd.c */
+int				builtin_cd(char **args, t_env *env);
+
+/* builtins/cd_path.c */
+char			*normalize_path_segments(char *path);
+char			*normalize_path(char *path, t_env *env);
+
+/* builtins/cd_utils.c */
+int				calculate_total_length(char **stack, int count);
+void			build_path_string(char **stack, int count,
+					char *result, int absolute);
+char			*rebuild_path(char **stack, int count, int absolute);
+
+/* builtins/pwd.c */
+int				builtin_pwd(void);
+
+/* builtins/export.c */
+int				builtin_export(char **args, t_env *env);
+
+/* builtins/export_display.c */
+void			print_sorted_env(char **env);
+void			print_export_error(char *arg);
+
+/* builtins/unset.c */
+int				builtin_unset(char **args, t_env *env);
+
+/* builtins/env.c */
+int				builtin_env(t_env *env);
+
+/* builtins/exit.c */
+int				builtin_exit(char **args, t_shell *shell);
+
+/* builtins/hash.c */
+int				builtin_hash(char **args, t_shell *shell);
+
+/* builtins/wait.c */
+int				builtin_wait(char **args, t_shell *shell);
+
+/* builtins/history.c */
+int				builtin_history(char **args, t_shell *shell);
+
+/* jobs/job_table.c */
+void			jobs_init(t_job_table *table);
+void			jobs_destroy(t_job_table *table);
+t_job			*job_start(t_job_table *table, int count);
+void			job_track(t_job *job, int index, pid_t pid);
+void			job_finish(t_job_table *table, t_job *job);
+
+/* jobs/job_reap.c */
+int				jobs_reap(t_job_table *table);
+int				job_wait(t_job_table *table, t_job *job, int index);
+int				job_exit_code(t_job *job, int index);
+
+/* jobs/job_control.c */
+int				job_settle(t_shell *shell, t_job *job, int last);
+t_job			*job_find(t_job_table *table, int value, int job_spec,
+					int *index);
+int				job_claim(t_job_table *table, t_job *job, int index);
+
+/* jobs/job_done.c */
+void			jobs_prune(t_job_table *table);
+int				job_done_status(t_job_table *table, int value, int job_spec,
+					int *status);
+
+/* signals/signals.c */
+void			handle_sigusr1(int sig);
+void			setup_signals(void);
+void			setup_child_signals(void);
+void			handle_sigint(int sig);
+void			handle_sigquit(int sig);
+int				check_signals_hook(void);
+
+/* signals/signal_heredoc.c */
+void			handle_sigint_heredoc(int sig);
+void			setup_heredoc_signals(void);
+
+/* environment/env_core.c */
+t_env			*env_create(char **envp);
+void			env_destroy(t_env *env);
+char			*get_env_value(t_env *env, char *key);
+int				find_env_index(t_env *env, char *key);
+
+/* environment/env_modify.c */
+int				env_put_entry(t_env *env, char *new_entry);
+int				set_env_value(t_env *env, char *key, char *value);
+int				unset_env_value(t_env *env, char *key);
+
+/* environment/env_table.c */
+int				env_key_len(char *entry);
+int				env_table_lookup(t_env *env, char *key, int len);
+char			*get_env_value_len(t_env *env, char *key, int len);
+int				env_table_rebuild(t_env *env);
+
+/* environment/env_storage.c */
+int				env_grow_vars(t_env *env);
+void			env_compact_vars(t_env *env);
+char			**env_to_envp(t_env *env);
+
+/* memory/array_utils.c */
+void			free_string_array(char **array);
+int				count_string_array(char **array);
+char			**duplicate_string_array(char **array);
+
+/* memory/cleanup.c */
+void			init_shell(t_shell *shell, char **envp);
+void			cleanup_shell(t_shell *shell);
+void			error_exit(char *msg, int exit_code);
+void			print_error(char *cmd, char *msg);
+void			print_error3(char *head, char *arg, char *tail);
+
+/* output/output.c */
+void			out_init(t_out *out, int fd);
+void			out_put(t_out *out, char *s, size_t len);
+void			out_str(t_out *out, char *s);
+void			out_copy(t_out *out, char *s, size_t len);
+
+/* output/output_flush.c */
+int				out_flush(t_out *out);
+
+/* string/string_basic.c */
+int				ft_strcmp(const char *s1, const char *s2);
+int				ft_strncmp(const char *s1, const char *s2, size_t n);
+size_t			ft_strlen(const char *s);
+char			*ft_strchr(const char *s, int c);
+int				ft_isdigit(int c);
+
+/* string/string_copy.c */
+char			*ft_strdup(const char *s);
+char			*ft_strjoin(char const *s1, char const *s2);
+char			*ft_strcpy(char *dst, const char *src);
+char			*ft_strcat(char *dst, const char *src);
+char			*ft_strncpy(char *dst, const char *src, size_t n);
+
+/* string/ft_memory.c */
+void			*ft_memcpy(void *dst, const void *src, size_t n);
+void			*ft_memmove(void *dst, const void *src, size_t n);
+
+/* string/ft_strstr.c */
+char			*ft_strstr(const char *haystack, const char *needle);
+
+/* string/ft_atoi.c */
+int				ft_atoi(const char *str);
+
+/* string/ft_itoa.c */
+char			*ft_itoa(int n);
+
+/* string/ft_split_utils.c */
+int				count_words(char const *s, char c);
+int				get_word_len(char const *s, char c);
+void			free_split(char **array, int i);
+char			*extract_word(char const *s, int len);
+char			**allocate_split_array(char const *s, char c);
+
+/* string/ft_split.c */
+int				fill_split_array(char **array, char const *s, char c);
+char			**ft_split(char const *s, char c);
+
 #endif
\ No newline at end of file
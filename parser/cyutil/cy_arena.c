@@ -0,0 +1,66 @@
+#include "../prser.h"
+
+static t_arena_block	**cy_arena_head(void)
+{
+	static t_arena_block	*head = NULL;
+
+	return (&head);
+}
+
+static t_arena_block	*cy_arena_new_block(size_t size)
+{
+	t_arena_block	*block;
+
+	if (size < CY_ARENA_BLOCK)
+		size = CY_ARENA_BLOCK;
+	block = malloc(sizeof(t_arena_block) + size);
+	if (!block)
+		return (NULL);
+	block->size = size;
+	block->used = 0;
+	block->next = *cy_arena_head();
+	*cy_arena_head() = block;
+	return (block);
+}
+
+void	*cy_arena_alloc(size_t size)
+{
+	t_arena_block	*block;
+	void			*ptr;
+
+	size = (size + 15) & ~((size_t)15);
+	block = *cy_arena_head();
+	if (!block || block->used + size > block->size)
+		block = cy_arena_new_block(size);
+	if (!block)
+		return (NULL);
+	ptr = (char *)(block + 1) + block->used;
+	block->used = block->used + size;
+	return (ptr);
+}
+
+void	cy_arena_reset(void)
+{
+	t_arena_block	*block;
+	t_arena_block	*next;
+
+	block = *cy_arena_head();
+	if (!block)
+		return ;
+	next = block->next;
+	block->next = NULL;
+	block->used = 0;
+	while (next)
+	{
+		block = next->next;
+		free(next);
+		next = block;
+	}
+}
+
+void	cy_arena_release(void)
+{
+	cy_arena_reset();
+	free(*cy_arena_head());
+	*cy_arena_head() = NULL;
+}
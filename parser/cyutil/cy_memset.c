@@ -1,16 +1,33 @@
-#include "../prser.h"
-
-void	*cy_memset(void *s, int c, size_t n)
-{
-	size_t			i;
-	unsigned char	*tmp;
-
-	tmp = (unsigned char *)s;
-	i = 0;
-	while (i < n)
-	{
-		tmp[i] = c;
-		i = i + 1;
-	}
-	return (s);
-}
+#include "../prser.h"
+
+void	*cy_memset(void *s, int c, size_t n)
+{
+	size_t			i;
+	unsigned char	*tmp;
+
+	tmp = (unsigned char *)s;
+	i = 0;
+	while (i < n)
+	{
+		tmp[i] = c;
+		i = i + 1;
+	}
+	return (s);
+}
+
+void	*cy_memcpy(void *dst, const void *src, size_t n)
+{
+	size_t				i;
+	unsigned char		*d;
+	const unsigned char	*s;
+
+	d = (unsigned char *)dst;
+	s = (const unsigned char *)src;
+	i = 0;
+	while (i < n)
+	{
+		d[i] = s[i];
+		i = i + 1;
+	}
+	return (dst);
+}
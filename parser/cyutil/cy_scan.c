@@ -0,0 +1,23 @@
+#include "../prser.h"
+
+#ifndef __SSE2__
+
+int	cy_scan(const char *s, int i, const char *set, int blanks)
+{
+	int	k;
+
+	while (s[i])
+	{
+		if (blanks && ((s[i] >= '\t' && s[i] <= '\r') || s[i] == ' '))
+			return (i);
+		k = 0;
+		while (set[k] && set[k] != s[i])
+			k = k + 1;
+		if (set[k])
+			return (i);
+		i = i + 1;
+	}
+	return (i);
+}
+
+#endif
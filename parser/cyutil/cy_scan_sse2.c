@@ -0,0 +1,65 @@
+#include "../prser.h"
+
+#ifdef __SSE2__
+# include <emmintrin.h>
+# include <stdint.h>
+
+static void	cy_scan_needles(__m128i *needle, const char *set)
+{
+	int	k;
+	int	end;
+
+	k = 0;
+	end = 0;
+	while (k < 3)
+	{
+		if (!end && !set[k])
+			end = 1;
+		needle[k] = _mm_setzero_si128();
+		if (!end)
+			needle[k] = _mm_set1_epi8(set[k]);
+		k = k + 1;
+	}
+	needle[3] = _mm_set1_epi8(' ');
+}
+
+static int	cy_scan_hits(__m128i v, __m128i *needle, int blanks)
+{
+	__m128i	hit;
+	__m128i	off;
+
+	hit = _mm_cmpeq_epi8(v, _mm_setzero_si128());
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, needle[0]));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, needle[1]));
+	hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, needle[2]));
+	if (blanks)
+	{
+		hit = _mm_or_si128(hit, _mm_cmpeq_epi8(v, needle[3]));
+		off = _mm_sub_epi8(v, _mm_set1_epi8('\t'));
+		off = _mm_cmpeq_epi8(_mm_min_epu8(off, _mm_set1_epi8(4)), off);
+		hit = _mm_or_si128(hit, off);
+	}
+	return (_mm_movemask_epi8(hit));
+}
+
+__attribute__((no_sanitize_address))
+int	cy_scan(const char *s, int i, const char *set, int blanks)
+{
+	__m128i		needle[4];
+	const char	*p;
+	int			mask;
+
+	cy_scan_needles(needle, set);
+	p = (const char *)((uintptr_t)(s + i) & ~(uintptr_t)15);
+	mask = cy_scan_hits(_mm_load_si128((const __m128i *)p), needle, blanks);
+	mask = mask >> (s + i - p) << (s + i - p);
+	while (mask == 0)
+	{
+		p = p + 16;
+		mask = cy_scan_hits(_mm_load_si128((const __m128i *)p),
+				needle, blanks);
+	}
+	return ((int)(p - s) + __builtin_ctz(mask));
+}
+
+#endif
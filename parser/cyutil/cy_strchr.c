@@ -1,19 +1,19 @@
-#include "../prser.h"
-
-char	*cy_strchr(const char *s, int c)
-{
-	size_t	i;
-	char	*tmp;
-
-	i = 0;
-	tmp = (char *)s;
-	while (1)
-	{
-		if (tmp[i] == c)
-			return (&tmp[i]);
-		if (tmp[i] == '\0')
-			break ;
-		i = i + 1;
-	}
-	return (NULL);
-}
+#include "../prser.h"
+
+char	*cy_strchr(const char *s, int c)
+{
+	size_t	i;
+	char	*tmp;
+
+	i = 0;
+	tmp = (char *)s;
+	while (1)
+	{
+		if (tmp[i] == c)
+			return (&tmp[i]);
+		if (tmp[i] == '\0')
+			break ;
+		i = i + 1;
+	}
+	return (NULL);
+}
@@ -1,29 +1,29 @@
-#include "../prser.h"
-
-int	cy_strcmp(const char *s1, const char *s2)
-{
-	int				i;
-	unsigned char	*str1;
-	unsigned char	*str2;
-
-	str1 = (unsigned char *)s1;
-	str2 = (unsigned char *)s2;
-	i = 0;
-	while (str1[i] && str2[i] && str1[i] == str2[i])
-		i = i + 1;
-	return (str1[i] - str2[i]);
-}
-
-int	cy_strncmp(const char *s1, const char *s2, size_t n)
-{
-	size_t	i;
-
-	i = 0;
-	if (n == 0)
-		return (0);
-	while (s1[i] && s1[i] == s2[i] && i < n)
-		i = i + 1;
-	if (i < n)
-		return ((unsigned char) s1[i] - (unsigned char) s2[i]);
-	return (0);
-}
+#include "../prser.h"
+
+int	cy_strcmp(const char *s1, const char *s2)
+{
+	int				i;
+	unsigned char	*str1;
+	unsigned char	*str2;
+
+	str1 = (unsigned char *)s1;
+	str2 = (unsigned char *)s2;
+	i = 0;
+	while (str1[i] && str2[i] && str1[i] == str2[i])
+		i = i + 1;
+	return (str1[i] - str2[i]);
+}
+
+int	cy_strncmp(const char *s1, const char *s2, size_t n)
+{
+	size_t	i;
+
+	i = 0;
+	if (n == 0)
+		return (0);
+	while (s1[i] && s1[i] == s2[i] && i < n)
+		i = i + 1;
+	if (i < n)
+		return ((unsigned char) s1[i] - (unsigned char) s2[i]);
+	return (0);
+}
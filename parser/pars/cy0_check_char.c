@@ -1,59 +1,71 @@
-#include "../prser.h"
-
-int	analyse_char(char c)
-{
-	if (c == '>')
-		return (-4);
-	if (c == '<')
-		return (-5);
-	if (c == '|')
-		return (-6);
-	if (c == '$')
-		return (-7);
-	if (c == '=')
-		return (-8);
-	if (c == '-')
-		return (-9);
-	if (c == '/')
-		return (-10);
-	if (c == '~')
-		return (-11);
-	if (c == '.')
-		return (-12);
-	if (c == 0)
-		return (0);
-	return (-13);
-}
-
-int	cy0_analyse_char(char c)
-{
-	if ((c >= '\t' && c <= '\r') || c == ' ')
-		return (-1);
-	if (c == '?')
-		return (-14);
-	if (c == '\'')
-		return (-2);
-	if (c == '"')
-		return (-3);
-	return (analyse_char(c));
-}
-
-int	cy0_analyse_char2(char c)
-{
-	if ((c >= '\t' && c <= '\r') || c == ' ')
-		return (-1);
-	if (c == '#' || c == '&'
-		|| c == '{' || c == '}' || c == '(' || c == ')'
-		|| c == '%' || c == ';' || c == '@')
-		return (1);
-	if (c == '`' || c == '\\' || c == '*' || c == '!'
-		|| c == '[' || c == ']')
-		return (2);
-	if (c == '?')
-		return (-14);
-	if (c == '\'')
-		return (-2);
-	if (c == '"')
-		return (-3);
-	return (analyse_char(c));
-}
+#include "../prser.h"
+
+const signed char	g_cy0_class[256] = {
+	0, -13, -13, -13, -13, -13, -13, -13,
+	-13, -1, -1, -1, -1, -1, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-1, -13, -3, -13, -7, -13, -13, -2,
+	-13, -13, -13, -13, -13, -9, -12, -10,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -5, -8, -4, -14,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -6, -13, -11, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13
+};
+
+const signed char	g_cy0_class2[256] = {
+	0, -13, -13, -13, -13, -13, -13, -13,
+	-13, -1, -1, -1, -1, -1, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-1, 2, -3, 1, -7, -13, 1, -2,
+	1, 1, 2, -13, -13, -9, -12, -10,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, 1, -5, -8, -4, -14,
+	1, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, 2, 2, 2, -13, -13,
+	2, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, 1, -6, 1, -11, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13,
+	-13, -13, -13, -13, -13, -13, -13, -13
+};
@@ -1,39 +1,60 @@
-#include "../prser.h"
-
-static int	cy1_make_list_1(t_input **head, int *start,
-	int *end, char *input)
-{
-	int	error;
-
-	*end = cy1_identify_end(input, start);
-	error = cy1_append_input(head, *start, *end, input);
-	if (error == 1)
-	{
-		cy0_free_input_list(*head);
-		return (1);
-	}
-	if (*start < 0)
-		*start = *start + INT_MAX + 1;
-	if (*end < 0)
-		*end = -*end;
-	*start = *end + 1;
-	return (0);
-}
-
-t_input	*cy1_make_list(char *input)
-{
-	t_input	*head;
-	int		start;
-	int		end;
-
-	head = NULL;
-	start = 0;
-	while (cy0_analyse_char(input[start]) == -1)
-		start = start + 1;
-	while (input[start])
-	{
-		if (cy1_make_list_1(&head, &start, &end, input) == 1)
-			return (NULL);
-	}
-	return (head);
-}
+#include "../prser.h"
+
+static int	cy1_fill_node(t_input *node, t_token *token, char *input)
+{
+	int	len;
+
+	len = token->end - token->start;
+	node->input = cy_arena_alloc(len + 1);
+	if (!node->input)
+		return (1);
+	cy_memcpy(node->input, input + token->start, len);
+	node->input[len] = '\0';
+	node->spans = NULL;
+	node->nspans = 0;
+	node->type = token->type;
+	node->column = token->start + 1;
+	if (token->type >= 3)
+		node->column = token->start;
+	return (0);
+}
+
+static void	cy1_link_nodes(t_input *nodes, int count)
+{
+	int	i;
+
+	i = 0;
+	while (i < count)
+	{
+		nodes[i].number = i + 1;
+		nodes[i].prev = NULL;
+		nodes[i].next = NULL;
+		if (i > 0)
+			nodes[i].prev = &nodes[i - 1];
+		if (i + 1 < count)
+			nodes[i].next = &nodes[i + 1];
+		i = i + 1;
+	}
+}
+
+t_input	*cy1_make_list(char *input)
+{
+	t_token_list	list;
+	t_input			*nodes;
+	int				i;
+
+	if (cy1_lex(input, &list) || list.count == 0)
+		return (NULL);
+	nodes = cy_arena_alloc(sizeof(t_input) * list.count);
+	if (!nodes)
+		return (NULL);
+	cy1_link_nodes(nodes, list.count);
+	i = 0;
+	while (i < list.count)
+	{
+		if (cy1_fill_node(&nodes[i], &list.tokens[i], input))
+			return (NULL);
+		i = i + 1;
+	}
+	return (nodes);
+}
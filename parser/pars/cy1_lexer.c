@@ -0,0 +1,91 @@
+#include "../prser.h"
+
+static int	cy1_push_token(t_token_list *list, int start, int end, int type)
+{
+	t_token	*grown;
+	int		i;
+
+	if (list->count == list->capacity)
+	{
+		list->capacity = list->capacity * 2 + 16;
+		grown = cy_arena_alloc(sizeof(t_token) * list->capacity);
+		if (!grown)
+			return (1);
+		i = -1;
+		while (++i < list->count)
+			grown[i] = list->tokens[i];
+		list->tokens = grown;
+	}
+	list->tokens[list->count].start = start;
+	list->tokens[list->count].end = end;
+	list->tokens[list->count].type = type;
+	list->count = list->count + 1;
+	return (0);
+}
+
+static int	cy1_lex_quote(char *input, int start, t_token_list *list)
+{
+	int		end;
+	int		type;
+	char	*quote;
+
+	type = 3;
+	quote = "'";
+	if (input[start] == '"')
+	{
+		type = 4;
+		quote = "\"";
+	}
+	end = cy_scan(input, start + 1, quote, 0);
+	if (cy1_push_token(list, start + 1, end, type))
+		return (-1);
+	return (end + 1);
+}
+
+static int	cy1_lex_run(char *input, int start, t_token_list *list)
+{
+	int	end;
+	int	type;
+
+	end = start;
+	if (g_cy0_class[(unsigned char)input[start]] == -1)
+	{
+		type = 1;
+		while (g_cy0_class[(unsigned char)input[end]] == -1)
+			end = end + 1;
+	}
+	else
+	{
+		type = 2;
+		end = start + 1;
+		if (input[start] != ';')
+			end = cy_scan(input, start, "'\";", 1);
+	}
+	if (cy1_push_token(list, start, end, type))
+		return (-1);
+	return (end);
+}
+
+int	cy1_lex(char *input, t_token_list *list)
+{
+	int	pos;
+	int	id;
+
+	list->tokens = NULL;
+	list->count = 0;
+	list->capacity = 0;
+	pos = 0;
+	while (g_cy0_class[(unsigned char)input[pos]] == -1)
+		pos = pos + 1;
+	while (pos >= 0 && input[pos])
+	{
+		id = g_cy0_class[(unsigned char)input[pos]];
+		if (id == -2 || id == -3)
+			pos = cy1_lex_quote(input, pos, list);
+		else
+			pos = cy1_lex_run(input, pos, list);
+	}
+	if (pos < 0)
+		return (1);
+	return (0);
+}
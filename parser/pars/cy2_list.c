@@ -0,0 +1,58 @@
+#include "../prser.h"
+
+int	cy2_list_op(t_input *tok)
+{
+	if (tok->type != 2)
+		return (0);
+	if (cy_strcmp(tok->input, ";") == 0)
+		return (CY2_SEQ);
+	if (cy_strcmp(tok->input, "&&") == 0)
+		return (CY2_AND);
+	if (cy_strcmp(tok->input, "||") == 0)
+		return (CY2_OR);
+	return (0);
+}
+
+static void	cy2_list_trim(t_input *node)
+{
+	while (node->next)
+		node = node->next;
+	if (node->prev && cy2_list_op(node) == CY2_SEQ)
+		node->prev->next = NULL;
+}
+
+static t_cmd_list	*cy2_list_cut(t_cmd_list *tail, t_input *op)
+{
+	tail->op = cy2_list_op(op);
+	tail->next = cy2_list_node(op->next);
+	if (op->prev)
+		op->prev->next = NULL;
+	if (op->next)
+		op->next->prev = NULL;
+	return (tail->next);
+}
+
+t_cmd_list	*cy2_split_list(t_input *head, t_syntax *err)
+{
+	t_cmd_list	*list;
+	t_cmd_list	*tail;
+	t_input		*node;
+
+	err->token = NULL;
+	cy1_remove_space_nodes(&head);
+	if (!head || cy4_validate(head, err, 1))
+		return (NULL);
+	cy2_list_trim(head);
+	list = cy2_list_node(head);
+	tail = list;
+	node = head;
+	while (tail && node)
+	{
+		if (cy2_list_op(node))
+			tail = cy2_list_cut(tail, node);
+		node = node->next;
+	}
+	if (!tail)
+		return (NULL);
+	return (list);
+}
@@ -0,0 +1,62 @@
+#include "../prser.h"
+
+t_cmd	*cy2_new_cmd(void)
+{
+	t_cmd	*cmd;
+
+	cmd = cy_arena_alloc(sizeof(t_cmd));
+	if (!cmd)
+		return (NULL);
+	cmd->args = NULL;
+	cmd->redirs = NULL;
+	cmd->builtin_id = -1;
+	cmd->next = NULL;
+	return (cmd);
+}
+
+t_cmd_list	*cy2_list_node(t_input *tokens)
+{
+	t_cmd_list	*node;
+
+	node = cy_arena_alloc(sizeof(t_cmd_list));
+	if (!node)
+		return (NULL);
+	node->tokens = tokens;
+	node->cmds = NULL;
+	node->op = 0;
+	node->next = NULL;
+	return (node);
+}
+
+t_cmd	*cy2_parse_pipeline(t_input **tok)
+{
+	t_cmd	*head;
+	t_cmd	*tail;
+
+	head = cy2_parse_command(tok);
+	tail = head;
+	while (tail && *tok && cy_strcmp((*tok)->input, "|") == 0)
+	{
+		*tok = (*tok)->next;
+		if (*tok)
+			tail->next = cy2_parse_command(tok);
+		else
+			tail->next = cy2_new_cmd();
+		tail = tail->next;
+	}
+	if (!tail)
+		return (NULL);
+	return (head);
+}
+
+t_cmd	*cy2_convert_cmd(t_input *head_input)
+{
+	t_input	*tok;
+	t_cmd	*cmds;
+
+	tok = head_input;
+	cmds = cy2_parse_pipeline(&tok);
+	if (tok)
+		return (NULL);
+	return (cmds);
+}
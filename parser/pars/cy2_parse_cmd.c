@@ -0,0 +1,95 @@
+#include "../prser.h"
+
+static int	cy2_redir_type(const char *s)
+{
+	if (cy_strcmp(s, "<") == 0)
+		return (0);
+	if (cy_strcmp(s, ">") == 0)
+		return (1);
+	if (cy_strcmp(s, ">>") == 0)
+		return (2);
+	if (cy_strcmp(s, "<<") == 0)
+		return (3);
+	return (-1);
+}
+
+static int	cy2_is_operator(t_input *tok)
+{
+	if (tok->type != 2)
+		return (0);
+	return (cy2_redir_type(tok->input) >= 0
+		|| cy_strcmp(tok->input, "|") == 0 || cy2_list_op(tok));
+}
+
+static int	cy2_push_arg(t_cmd *cmd, int *count, int *cap, char *arg)
+{
+	char	**grown;
+	int		i;
+
+	if (*count + 1 == *cap)
+	{
+		*cap = *cap * 2;
+		grown = cy_arena_alloc(sizeof(char *) * *cap);
+		if (!grown)
+			return (1);
+		i = -1;
+		while (++i < *count)
+			grown[i] = cmd->args[i];
+		cmd->args = grown;
+	}
+	cmd->args[*count] = arg;
+	*count = *count + 1;
+	cmd->args[*count] = NULL;
+	return (0);
+}
+
+static int	cy2_parse_redirs(t_input **tok, t_cmd *cmd)
+{
+	t_redir	**link;
+	int		type;
+
+	link = &cmd->redirs;
+	while (*tok && cy_strcmp((*tok)->input, "|") != 0 && !cy2_list_op(*tok))
+	{
+		type = cy2_redir_type((*tok)->input);
+		if (type < 0 || !(*tok)->next)
+			return (1);
+		*link = cy_arena_alloc(sizeof(t_redir));
+		if (!*link)
+			return (1);
+		(*link)->type = type;
+		(*link)->file = (*tok)->next->input;
+		(*link)->fd = -1;
+		(*link)->next = NULL;
+		link = &(*link)->next;
+		*tok = (*tok)->next->next;
+	}
+	return (0);
+}
+
+t_cmd	*cy2_parse_command(t_input **tok)
+{
+	t_cmd	*cmd;
+	int		count;
+	int		cap;
+
+	cmd = cy2_new_cmd();
+	if (!cmd)
+		return (NULL);
+	count = 0;
+	cap = 8;
+	cmd->args = cy_arena_alloc(sizeof(char *) * cap);
+	if (!cmd->args)
+		return (NULL);
+	cmd->args[0] = NULL;
+	while (*tok && !cy2_is_operator(*tok))
+	{
+		if (cy2_push_arg(cmd, &count, &cap, (*tok)->input))
+			return (NULL);
+		*tok = (*tok)->next;
+	}
+	cy2_fill_builtin_id(cmd);
+	if (cy2_parse_redirs(tok, cmd))
+		return (NULL);
+	return (cmd);
+}
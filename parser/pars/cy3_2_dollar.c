@@ -1,102 +1,123 @@
-#include "../prser.h"
-
-int	cy3_scan_dollar_syntax_2(t_input *current, int i, char **env, int exit_code)
-{
-	int	j;
-
-	if (current->input[i + 1] == '?')
-	{
-		if (current->input_num[i + 1] != current->input_num[i])
-			return (1);
-		j = i + 1;
-		i = cy3_handle_dollar_bang(current, i, j, exit_code);
-		if (i == -1)
-			return (1);
-		return (0);
-	}
-	return (cy3_scan_dollar_syntax_2_1(current, i, env));
-}
-
-int	cy3_scan_dollar_syntax_dollar_1(t_input *current,
-									int *i,
-									char **env,
-									int exit_code)
-{
-	if (current->input[*i + 2] && current->input[*i + 3]
-		&& current->input[*i + 3] == '}' && current->input[*i + 2] == '?'
-		&& current->input_num[*i] == current->input_num[*i + 1]
-		&& current->input_num[*i + 1] == current->input_num[*i + 2]
-		&& current->input_num[*i + 2] == current->input_num[*i + 3])
-	{
-		*i = cy3_handle_dollar_bang(current, *i, *i + 3, exit_code);
-		if (*i == -1)
-			return (1);
-		*i = *i + 1;
-		return (0);
-	}
-	if (cy3_scan_dollar_syntax_1_1(current, *i, env))
-		return (1);
-	return (0);
-}
-
-int	cy3_scan_dollar_syntax_dollar_2(t_input *current,
-		int *i, char **env, int exit_code)
-{
-	if ((current->input[*i + 1] >= 'A' && current->input[*i + 1] <= 'Z')
-		|| (current->input[*i + 1] >= 'a' && current->input[*i + 1] <= 'z')
-		|| current->input[*i + 1] == '_'
-		|| current->input[*i + 1] == '?')
-	{
-		if (cy3_scan_dollar_syntax_2(current, *i, env, exit_code))
-			return (1);
-	}
-	else
-	{
-		*i = cy3_handle_dollar_alone(current, *i);
-		if (*i == -1)
-			return (1);
-	}
-	return (0);
-}
-
-int	cy3_scan_dollar_syntax_dollar(t_input *current,
-								int *i,
-								char **env,
-								int exit_code)
-{
-	if (current->input[*i + 1] == '\0'
-		|| current->input_num[*i + 1] != current->input_num[*i])
-	{
-		*i = *i + 1;
-		return (0);
-	}
-	else if (current->input[*i + 1] == '{')
-		return (cy3_scan_dollar_syntax_dollar_1(current, i, env, exit_code));
-	else
-		return (cy3_scan_dollar_syntax_dollar_2(current, i, env, exit_code));
-	return (0);
-}
-
-int	cy3_scan_dollar_syntax(t_input *head, char **env, int exit_code)
-{
-	t_input	*current;
-	int		i;
-
-	current = head;
-	while (current)
-	{
-		i = 0;
-		while (current->input && current->input[i])
-		{
-			if (current->input[i] == '$' && current->type != 3)
-			{
-				if (cy3_scan_dollar_syntax_dollar(current, &i, env, exit_code))
-					return (1);
-				continue ;
-			}
-			i = i + 1;
-		}
-		current = current->next;
-	}
-	return (0);
-}
+#include "../prser.h"
+
+static void	cy3_status_str(char *buf, int code)
+{
+	long	n;
+	long	div;
+	int		p;
+
+	n = code;
+	p = 0;
+	if (n < 0)
+	{
+		buf[p] = '-';
+		p = p + 1;
+		n = -n;
+	}
+	div = 1;
+	while (n / div >= 10)
+		div = div * 10;
+	while (div > 0)
+	{
+		buf[p] = '0' + (n / div) % 10;
+		p = p + 1;
+		div = div / 10;
+	}
+	buf[p] = '\0';
+}
+
+static int	cy3_expand_measure(t_input *current, t_expand *x, int *len)
+{
+	int	i;
+	int	changed;
+
+	i = 0;
+	*len = 0;
+	changed = 0;
+	while (current->input[i])
+	{
+		if (cy3_dollar_decode(current, i, x))
+			return (-1);
+		if (x->value)
+			changed = changed + 1;
+		*len = *len + x->vlen;
+		i = i + x->used;
+	}
+	return (changed);
+}
+
+static int	cy3_expand_put(t_input *current, int i, t_expand *x, int *p)
+{
+	t_span	run;
+	int		k;
+
+	cy3_dollar_decode(current, i, x);
+	if (!x->value)
+	{
+		cy3_span_copy(current, i, x, *p);
+		x->value = current->input + i;
+	}
+	else
+	{
+		run.type = 5;
+		run.num = current->spans[cy3_span_at(current, i)].num;
+		run.end = *p + x->vlen;
+		cy3_span_push(x->spans, &x->nspans, run);
+	}
+	k = 0;
+	while (k < x->vlen)
+	{
+		x->input[*p + k] = x->value[k];
+		k = k + 1;
+	}
+	*p = *p + x->vlen;
+	return (x->used);
+}
+
+static int	cy3_expand_token(t_input *current, t_expand *x)
+{
+	int	len;
+	int	i;
+	int	p;
+
+	i = cy3_expand_measure(current, x, &len);
+	if (i <= 0)
+		return (i < 0);
+	x->input = cy_arena_alloc(len + 1);
+	x->spans = cy_arena_alloc(sizeof(t_span) * (current->nspans + 2 * i));
+	if (!x->input || !x->spans)
+		return (1);
+	x->nspans = 0;
+	i = 0;
+	p = 0;
+	while (current->input[i])
+		i = i + cy3_expand_put(current, i, x, &p);
+	x->input[p] = '\0';
+	current->input = x->input;
+	current->spans = x->spans;
+	current->nspans = x->nspans;
+	return (0);
+}
+
+int	cy3_scan_dollar_syntax(t_input *head, t_env *env, int exit_code,
+		int bg_pid)
+{
+	t_expand	x;
+	t_input		*current;
+
+	x.env = env;
+	cy3_status_str(x.status, exit_code);
+	x.bg_pid[0] = '\0';
+	if (bg_pid > 0)
+		cy3_status_str(x.bg_pid, bg_pid);
+	current = head;
+	while (current)
+	{
+		if (current->input
+			&& current->input[cy_scan(current->input, 0, "$", 0)]
+			&& cy3_expand_token(current, &x))
+			return (1);
+		current = current->next;
+	}
+	return (0);
+}
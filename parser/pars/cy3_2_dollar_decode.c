@@ -0,0 +1,82 @@
+#include "../prser.h"
+
+static int	cy3_is_name_char(char c)
+{
+	return ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')
+		|| (c >= '0' && c <= '9') || c == '_');
+}
+
+static int	cy3_dollar_set(t_expand *x, char *value, int used)
+{
+	if (!value)
+		value = "";
+	x->value = value;
+	x->vlen = cy_strlen(value);
+	x->used = used;
+	return (0);
+}
+
+static int	cy3_dollar_decode_brace(t_input *current, int i, t_expand *x)
+{
+	char	*s;
+	int		j;
+
+	s = current->input;
+	if (s[i + 2] == '?' && s[i + 3] == '}' && i + 3 < x->seg)
+		return (cy3_dollar_set(x, x->status, 4));
+	if (s[i + 2] != '}' && !(cy3_is_name_char(s[i + 2])
+			&& !(s[i + 2] >= '0' && s[i + 2] <= '9')))
+		return (1);
+	j = i + 2;
+	while (s[j] && s[j] != '}')
+	{
+		if (j >= x->seg || !cy3_is_name_char(s[j]))
+			return (1);
+		j = j + 1;
+	}
+	if (!s[j] || j >= x->seg)
+		return (1);
+	return (cy3_dollar_set(x,
+			get_env_value_len(x->env, s + i + 2, j - i - 2), j - i + 1));
+}
+
+static int	cy3_dollar_decode_word(t_input *current, int i, t_expand *x)
+{
+	int	j;
+
+	j = i + 1;
+	while (j < x->seg && cy3_is_name_char(current->input[j]))
+		j = j + 1;
+	return (cy3_dollar_set(x,
+			get_env_value_len(x->env, current->input + i + 1, j - i - 1),
+			j - i));
+}
+
+int	cy3_dollar_decode(t_input *current, int i, t_expand *x)
+{
+	char	c;
+	int		k;
+
+	x->value = NULL;
+	x->vlen = 1;
+	x->used = 1;
+	k = cy3_span_at(current, i);
+	x->seg = cy3_segment_end(current, k);
+	c = current->input[i + 1];
+	if (current->input[i] != '$' || current->spans[k].type == 3 || !c
+		|| i + 1 >= x->seg)
+	{
+		x->used = cy_scan(current->input, i + 1, "$", 0) - i;
+		x->vlen = x->used;
+		return (0);
+	}
+	if (c == '{')
+		return (cy3_dollar_decode_brace(current, i, x));
+	if (c == '?')
+		return (cy3_dollar_set(x, x->status, 2));
+	if (c == '!')
+		return (cy3_dollar_set(x, x->bg_pid, 2));
+	if (cy3_is_name_char(c) && !(c >= '0' && c <= '9'))
+		return (cy3_dollar_decode_word(current, i, x));
+	return (cy3_dollar_set(x, "", 1));
+}
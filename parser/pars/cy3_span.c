@@ -0,0 +1,69 @@
+#include "../prser.h"
+
+int	cy3_span_at(t_input *current, int i)
+{
+	int	k;
+
+	k = 0;
+	while (k + 1 < current->nspans && current->spans[k].end <= i)
+		k = k + 1;
+	return (k);
+}
+
+int	cy3_segment_end(t_input *current, int k)
+{
+	while (k + 1 < current->nspans
+		&& current->spans[k + 1].num == current->spans[k].num)
+		k = k + 1;
+	return (current->spans[k].end);
+}
+
+void	cy3_span_push(t_span *spans, int *n, t_span run)
+{
+	if (*n > 0 && spans[*n - 1].type == run.type
+		&& spans[*n - 1].num == run.num)
+	{
+		spans[*n - 1].end = run.end;
+		return ;
+	}
+	if (*n > 0 && spans[*n - 1].end == run.end)
+		return ;
+	spans[*n] = run;
+	*n = *n + 1;
+}
+
+void	cy3_span_append(t_span *spans, int *n, t_input *src, int shift)
+{
+	t_span	run;
+	int		k;
+
+	k = 0;
+	while (k < src->nspans)
+	{
+		run = src->spans[k];
+		run.end = run.end + shift;
+		cy3_span_push(spans, n, run);
+		k = k + 1;
+	}
+}
+
+void	cy3_span_copy(t_input *current, int i, t_expand *x, int p)
+{
+	t_span	run;
+	int		end;
+	int		k;
+
+	k = cy3_span_at(current, i);
+	end = i + x->used;
+	while (k < current->nspans)
+	{
+		run = current->spans[k];
+		if (run.end > end)
+			run.end = end;
+		run.end = run.end - i + p;
+		cy3_span_push(x->spans, &x->nspans, run);
+		if (current->spans[k].end >= end)
+			break ;
+		k = k + 1;
+	}
+}
@@ -1,30 +1,23 @@
 #include "../prser.h"
 
-static int	cy3_fill_input_type_1(t_input *current, int *flag)
+static int	cy3_fill_spans_1(t_input *current, int *flag)
 {
-	int	linput;
-
-	linput = cy_strlen(current->input);
-	current->input_type = malloc(linput + 1);
-	current->input_num = malloc(linput + 1);
-	if (!current->input_type || !current->input_num)
+	current->spans = cy_arena_alloc(sizeof(t_span));
+	if (!current->spans)
 		return (1);
-	cy_memset(current->input_type, current->type + '0', linput);
-	current->input_type[linput] = '\0';
+	current->nspans = 1;
+	current->spans[0].end = cy_strlen(current->input);
+	current->spans[0].type = current->type;
+	current->spans[0].num = 0;
 	if (current->type != 1)
 	{
-		cy_memset(current->input_num, *flag + '0', linput);
+		current->spans[0].num = *flag;
 		*flag = 3 - *flag;
 	}
-	else
-	{
-		cy_memset(current->input_num, '0', linput);
-	}
-	current->input_num[linput] = '\0';
 	return (0);
 }
 
-int	cy3_fill_input_type(t_input *head)
+static int	cy3_fill_spans(t_input *head)
 {
 	t_input	*current;
 	int		flag;
@@ -35,7 +28,7 @@ int	cy3_fill_input_type(t_input *head)
 	{
 		if (current->input)
 		{
-			if (cy3_fill_input_type_1(current, &flag))
+			if (cy3_fill_spans_1(current, &flag))
 				return (1);
 		}
 		current = current->next;
@@ -43,22 +36,15 @@ int	cy3_fill_input_type(t_input *head)
 	return (0);
 }
 
-int	cy3_substi_check(t_input **head_input, char **env)
+int	cy3_substi_check(t_input **head_input)
 {
 	int	ret;
 
-	(void) env;
-	ret = cy3_fill_input_type(*head_input);
+	ret = cy3_fill_spans(*head_input);
 	if (ret)
-	{
-		cy0_free_input_list(*head_input);
 		return (1);
-	}
 	ret = cy3_fuse_nospace(*head_input);
 	if (ret)
-	{
-		cy0_free_input_list(*head_input);
 		return (1);
-	}
 	return (0);
 }
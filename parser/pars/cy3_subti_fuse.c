@@ -1,89 +1,83 @@
-#include "../prser.h"
-
-static int	cy3_fuse_nospace_1(t_input *current,
-	t_input *fusing, int lcurrent, int lfusing)
-{
-	char	*new_input;
-	char	*new_type;
-	char	*new_num;
-
-	new_input = malloc(lcurrent + lfusing + 1);
-	new_type = malloc(lcurrent + lfusing + 1);
-	new_num = malloc(lcurrent + lfusing + 1);
-	if (!new_input || !new_type || !new_num)
-	{
-		free(new_input);
-		free(new_type);
-		free(new_num);
-		return (1);
-	}
-	cy_strlcpy(new_input, current->input, lcurrent + lfusing + 1);
-	cy_strlcat(new_input, fusing->input, lcurrent + lfusing + 1);
-	cy_strlcpy(new_type, current->input_type, lcurrent + lfusing + 1);
-	cy_strlcat(new_type, fusing->input_type, lcurrent + lfusing + 1);
-	cy_strlcpy(new_num, current->input_num, lcurrent + lfusing + 1);
-	cy_strlcat(new_num, fusing->input_num, lcurrent + lfusing + 1);
-	current->input = new_input;
-	current->input_type = new_type;
-	current->input_num = new_num;
-	return (0);
-}
-
-static void	cy3_fuse_nospace_2(t_input *current, t_input *fusing)
-{
-	current->next = fusing->next;
-	if (fusing->next)
-		fusing->next->prev = current;
-	free(fusing->input);
-	free(fusing->input_type);
-	free(fusing->input_num);
-	free(fusing);
-}
-
-static int	cy3_fuse_nospace_3(t_input *current, t_input *fusing)
-{
-	int		lcurrent;
-	int		lfusing;
-	char	*old_input;
-	char	*old_type;
-	char	*old_num;
-
-	lcurrent = cy_strlen(current->input);
-	lfusing = cy_strlen(fusing->input);
-	old_input = current->input;
-	old_type = current->input_type;
-	old_num = current->input_num;
-	if (cy3_fuse_nospace_1(current, fusing, lcurrent, lfusing))
-		return (1);
-	free(old_input);
-	free(old_type);
-	free(old_num);
-	cy3_fuse_nospace_2(current, fusing);
-	return (0);
-}
-
-int	cy3_fuse_nospace(t_input *head)
-{
-	t_input	*anchor;
-	t_input	*current;
-	t_input	*fusing;
-
-	anchor = head;
-	while (anchor)
-	{
-		if (anchor->type == 1)
-		{
-			anchor = anchor->next;
-			continue ;
-		}
-		current = anchor;
-		while (current->next && current->next->type != 1)
-		{
-			fusing = current->next;
-			if (cy3_fuse_nospace_3(current, fusing))
-				return (1);
-		}
-		anchor = anchor->next;
-	}
-	return (0);
-}
+#include "../prser.h"
+
+static int	cy3_is_break(t_input *node)
+{
+	return (node->type == 2 && cy_strcmp(node->input, ";") == 0);
+}
+
+static int	cy3_piece_len(t_input *node)
+{
+	return (node->spans[node->nspans - 1].end);
+}
+
+static t_input	*cy3_fuse_end(t_input *anchor, int *len, int *nspans)
+{
+	t_input	*last;
+
+	last = anchor;
+	*len = cy3_piece_len(anchor);
+	*nspans = anchor->nspans;
+	while (last->next && last->next->type != 1
+		&& !cy3_is_break(last->next))
+	{
+		last = last->next;
+		*len = *len + cy3_piece_len(last);
+		*nspans = *nspans + last->nspans;
+	}
+	return (last);
+}
+
+static int	cy3_fuse_word(t_input *anchor, t_input *last, int len,
+	int nspans)
+{
+	char	*word;
+	t_span	*spans;
+	t_input	*node;
+	int		p;
+	int		n;
+
+	word = cy_arena_alloc(len + 1);
+	spans = cy_arena_alloc(sizeof(t_span) * nspans);
+	if (!word || !spans)
+		return (1);
+	p = 0;
+	n = 0;
+	node = anchor;
+	while (node != last->next)
+	{
+		cy3_span_append(spans, &n, node, p);
+		cy_memcpy(word + p, node->input, cy3_piece_len(node));
+		p = p + cy3_piece_len(node);
+		node = node->next;
+	}
+	word[p] = '\0';
+	anchor->input = word;
+	anchor->spans = spans;
+	anchor->nspans = n;
+	return (0);
+}
+
+int	cy3_fuse_nospace(t_input *head)
+{
+	t_input	*anchor;
+	t_input	*last;
+	int		len;
+	int		nspans;
+
+	anchor = head;
+	while (anchor)
+	{
+		if (anchor->type != 1 && !cy3_is_break(anchor))
+		{
+			last = cy3_fuse_end(anchor, &len, &nspans);
+			if (last != anchor
+				&& cy3_fuse_word(anchor, last, len, nspans))
+				return (1);
+			anchor->next = last->next;
+			if (last->next)
+				last->next->prev = anchor;
+		}
+		anchor = anchor->next;
+	}
+	return (0);
+}
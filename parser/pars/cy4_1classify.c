@@ -0,0 +1,52 @@
+#include "../prser.h"
+
+static int	cy4_char_ok(char c, int type)
+{
+	int	class;
+
+	class = g_cy0_class2[(unsigned char)c];
+	if (type == 2 && (class >= 1 || class == -14))
+		return (0);
+	if (type == 4 && class == 2)
+		return (0);
+	return (1);
+}
+
+static int	cy4_exact_op(char *s)
+{
+	if (s[0] == '|' && s[1] == '\0')
+		return (CY4_PIPE);
+	if (s[0] != '<' && s[0] != '>')
+		return (-1);
+	if (s[1] == '\0' || (s[1] == s[0] && s[2] == '\0'))
+		return (CY4_REDIR);
+	return (-1);
+}
+
+int	cy4_classify(t_input *node, int loose)
+{
+	int	i;
+	int	ops;
+
+	if (!node->input)
+		return (CY4_WORD);
+	i = 0;
+	ops = 0;
+	while (node->input[i])
+	{
+		if (!loose && !cy4_char_ok(node->input[i], node->type))
+			return (-1);
+		if (node->input[i] == '|')
+			ops = ops | 2;
+		if (node->input[i] == '<' || node->input[i] == '>')
+			ops = ops | 1;
+		i = i + 1;
+	}
+	if (ops == 0)
+		return (CY4_WORD);
+	if (node->type == 2)
+		return (cy4_exact_op(node->input));
+	if (ops & 2)
+		return (CY4_QPIPE);
+	return (CY4_QREDIR);
+}
@@ -0,0 +1,62 @@
+#include "../prser.h"
+
+static int	cy4_next_state(int state, int category)
+{
+	static const signed char	table[5][5] = {
+	{CY4_S_WORD, -1, CY4_S_REDIR, CY4_S_WORD, -1},
+	{CY4_S_WORD, CY4_S_PIPE, CY4_S_REDIR, CY4_S_WORD, CY4_S_PIPE},
+	{CY4_S_WORD, -1, CY4_S_REDIR, CY4_S_WORD, -1},
+	{CY4_S_TARGET, -1, -1, -1, -1},
+	{-1, CY4_S_PIPE, CY4_S_REDIR, CY4_S_WORD, CY4_S_PIPE}};
+
+	return (table[state][category]);
+}
+
+static int	cy4_syntax_error(t_syntax *err, char *token, int column)
+{
+	err->token = token;
+	err->column = column;
+	return (1);
+}
+
+static int	cy4_step(t_input *node, int *state, int shape)
+{
+	int	category;
+
+	if (shape && cy2_list_op(node))
+	{
+		if (*state == CY4_S_START || *state == CY4_S_PIPE
+			|| *state == CY4_S_REDIR)
+			return (1);
+		*state = CY4_S_START;
+		return (0);
+	}
+	category = cy4_classify(node, shape && node->input
+			&& node->input[cy_scan(node->input, 0, "$", 0)]);
+	if (category >= 0)
+		*state = cy4_next_state(*state, category);
+	return (category < 0 || *state < 0);
+}
+
+int	cy4_validate(t_input *head, t_syntax *err, int shape)
+{
+	t_input	*node;
+	t_input	*last;
+	int		state;
+
+	state = CY4_S_START;
+	last = NULL;
+	node = head;
+	while (node)
+	{
+		if (cy4_step(node, &state, shape))
+			return (cy4_syntax_error(err, node->input, node->column));
+		last = node;
+		node = node->next;
+	}
+	if (state == CY4_S_REDIR
+		|| (state == CY4_S_START && last && cy2_list_op(last) > CY2_SEQ))
+		return (cy4_syntax_error(err, "newline",
+				last->column + cy_strlen(last->input)));
+	return (0);
+}
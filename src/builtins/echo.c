@@ -1,53 +1,56 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   echo.c                                             :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:37:16 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:37:16 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../includes/minishell.h"
-
-static int	is_n_option(char *arg)
-{
-	int	i;
-
-	if (!arg || arg[0] != '-' || arg[1] != 'n')
-		return (0);
-	i = 2;
-	while (arg[i])
-	{
-		if (arg[i] != 'n')
-			return (0);
-		i++;
-	}
-	return (1);
-}
-
-int	builtin_echo(char **args)
-{
-	int	i;
-	int	newline;
-
-	i = 1;
-	newline = 1;
-	while (args[i] && is_n_option(args[i]))
-	{
-		newline = 0;
-		i++;
-	}
-	while (args[i])
-	{
-		write(STDOUT_FILENO, args[i], ft_strlen(args[i]));
-		if (args[i + 1])
-			write(STDOUT_FILENO, " ", 1);
-		i++;
-	}
-	if (newline)
-		write(STDOUT_FILENO, "\n", 1);
-	return (0);
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   echo.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:37:16 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:37:16 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static int	is_n_option(char *arg)
+{
+	int	i;
+
+	if (!arg || arg[0] != '-' || arg[1] != 'n')
+		return (0);
+	i = 2;
+	while (arg[i])
+	{
+		if (arg[i] != 'n')
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+int	builtin_echo(char **args)
+{
+	t_out	out;
+	int		i;
+	int		newline;
+
+	out_init(&out, STDOUT_FILENO);
+	i = 1;
+	newline = 1;
+	while (args[i] && is_n_option(args[i]))
+	{
+		newline = 0;
+		i++;
+	}
+	while (args[i])
+	{
+		out_str(&out, args[i]);
+		if (args[i + 1])
+			out_put(&out, " ", 1);
+		i++;
+	}
+	if (newline)
+		out_put(&out, "\n", 1);
+	out_flush(&out);
+	return (0);
+}
@@ -1,32 +1,37 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   env.c                                              :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:37:29 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:37:29 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../includes/minishell.h"
-
-int	builtin_env(char **env)
-{
-	int	i;
-
-	if (!env)
-		return (1);
-	i = 0;
-	while (env[i])
-	{
-		if (ft_strchr(env[i], '='))
-		{
-			write(STDOUT_FILENO, env[i], ft_strlen(env[i]));
-			write(STDOUT_FILENO, "\n", 1);
-		}
-		i++;
-	}
-	return (0);
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:37:29 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:37:29 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+int	builtin_env(t_env *env)
+{
+	t_out	out;
+	int		i;
+	char	*entry;
+
+	if (!env)
+		return (1);
+	out_init(&out, STDOUT_FILENO);
+	i = 0;
+	while (i < env->count)
+	{
+		entry = env->vars[i];
+		if (entry && ft_strchr(entry, '='))
+		{
+			out_str(&out, entry);
+			out_put(&out, "\n", 1);
+		}
+		i++;
+	}
+	out_flush(&out);
+	return (0);
+}
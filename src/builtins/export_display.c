@@ -1,64 +1,65 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   export_display.c                                   :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:37:59 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:37:59 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../includes/minishell.h"
-
-static void	sort_env_array(char **env)
-{
-	int		i;
-	int		j;
-	char	*temp;
-
-	i = 0;
-	while (env[i])
-	{
-		j = i + 1;
-		while (env[j])
-		{
-			if (ft_strcmp(env[i], env[j]) > 0)
-			{
-				temp = env[i];
-				env[i] = env[j];
-				env[j] = temp;
-			}
-			j++;
-		}
-		i++;
-	}
-}
-
-static void	print_env_variables(char **env)
-{
-	int	i;
-
-	i = 0;
-	while (env[i])
-	{
-		write(STDOUT_FILENO, "declare -x ", 11);
-		write(STDOUT_FILENO, env[i], ft_strlen(env[i]));
-		write(STDOUT_FILENO, "\n", 1);
-		i++;
-	}
-}
-
-void	print_sorted_env(char **env)
-{
-	sort_env_array(env);
-	print_env_variables(env);
-}
-
-void	print_export_error(char *arg)
-{
-	write(STDERR_FILENO, "minishell: export: `", 20);
-	write(STDERR_FILENO, arg, ft_strlen(arg));
-	write(STDERR_FILENO, "': not a valid identifier\n", 26);
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   export_display.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:37:59 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:37:59 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static void	sort_env_array(char **env)
+{
+	int		i;
+	int		j;
+	char	*temp;
+
+	i = 0;
+	while (env[i])
+	{
+		j = i + 1;
+		while (env[j])
+		{
+			if (ft_strcmp(env[i], env[j]) > 0)
+			{
+				temp = env[i];
+				env[i] = env[j];
+				env[j] = temp;
+			}
+			j++;
+		}
+		i++;
+	}
+}
+
+static void	print_env_variables(char **env)
+{
+	t_out	out;
+	int		i;
+
+	out_init(&out, STDOUT_FILENO);
+	i = 0;
+	while (env[i])
+	{
+		out_put(&out, "declare -x ", 11);
+		out_str(&out, env[i]);
+		out_put(&out, "\n", 1);
+		i++;
+	}
+	out_flush(&out);
+}
+
+void	print_sorted_env(char **env)
+{
+	sort_env_array(env);
+	print_env_variables(env);
+}
+
+void	print_export_error(char *arg)
+{
+	print_error3("minishell: export: `", arg, "': not a valid identifier\n");
+}
@@ -0,0 +1,110 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hash.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:31:05 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 14:31:05 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static void	print_hash_entry(t_out *out, t_hash_entry *entry)
+{
+	char	*hits;
+	size_t	len;
+
+	hits = ft_itoa(entry->hits);
+	if (!hits)
+		return ;
+	len = ft_strlen(hits);
+	if (len < 4)
+		out_put(out, "    ", 4 - len);
+	out_copy(out, hits, len);
+	out_put(out, "\t", 1);
+	out_str(out, entry->path);
+	out_put(out, "\n", 1);
+	free(hits);
+}
+
+static int	print_hash_table(t_cmd_hash *table)
+{
+	t_hash_entry	*entry;
+	t_out			out;
+	int				printed;
+	int				i;
+
+	out_init(&out, STDOUT_FILENO);
+	printed = 0;
+	i = 0;
+	while (i < CMD_HASH_SIZE)
+	{
+		entry = table->buckets[i];
+		while (entry)
+		{
+			if (!printed)
+				out_put(&out, "hits\tcommand\n", 13);
+			printed = 1;
+			print_hash_entry(&out, entry);
+			entry = entry->next;
+		}
+		i++;
+	}
+	if (!printed)
+		out_put(&out, "hash: hash table empty\n", 23);
+	out_flush(&out);
+	return (0);
+}
+
+static int	hash_add_command(char *name, t_shell *shell)
+{
+	char	*cmd_path;
+
+	if (ft_strchr(name, '/'))
+		return (0);
+	cmd_path = search_in_path(name, shell->env);
+	if (!cmd_path)
+	{
+		print_error3("minishell: hash: ", name, ": not found\n");
+		return (1);
+	}
+	hash_insert(&shell->cmd_hash, name, cmd_path);
+	free(cmd_path);
+	return (0);
+}
+
+static int	hash_invalid_option(char *arg)
+{
+	print_error3("minishell: hash: ", arg,
+		": invalid option\nhash: usage: hash [-r] [name ...]\n");
+	return (2);
+}
+
+int	builtin_hash(char **args, t_shell *shell)
+{
+	int	i;
+	int	ret;
+
+	hash_sync_path(&shell->cmd_hash, shell->env);
+	if (!args[1])
+		return (print_hash_table(&shell->cmd_hash));
+	i = 1;
+	if (args[1][0] == '-' && args[1][1])
+	{
+		if (ft_strcmp(args[1], "-r") != 0)
+			return (hash_invalid_option(args[1]));
+		hash_clear(&shell->cmd_hash);
+		i++;
+	}
+	ret = 0;
+	while (args[i])
+	{
+		if (hash_add_command(args[i], shell) != 0)
+			ret = 1;
+		i++;
+	}
+	return (ret);
+}
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:41:27 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 14:41:27 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static int	history_usage(char *arg, char *msg)
+{
+	print_error3("minishell: history: ", arg, msg);
+	write(STDERR_FILENO, "history: usage: history [-S text]\n", 34);
+	return (2);
+}
+
+static void	print_entry(t_out *out, t_hist_index *idx, int id)
+{
+	char	*num;
+	size_t	len;
+
+	num = ft_itoa(idx->base + id + 1);
+	if (!num)
+		return ;
+	len = ft_strlen(num);
+	if (len < 5)
+		out_put(out, "     ", 5 - len);
+	out_copy(out, num, len);
+	out_put(out, "  ", 2);
+	out_str(out, idx->lines[id]);
+	out_put(out, "\n", 1);
+	free(num);
+}
+
+static int	print_matches(t_hist_index *idx, char *query)
+{
+	t_out	out;
+	int		*ids;
+	int		n;
+	int		id;
+	int		ret;
+
+	ids = malloc(sizeof(int) * (idx->count + 1));
+	if (!ids)
+		return (1);
+	n = 0;
+	id = hist_index_search(idx, query, idx->count);
+	while (id >= 0)
+	{
+		ids[n] = id;
+		n++;
+		id = hist_index_search(idx, query, id);
+	}
+	ret = (n == 0);
+	out_init(&out, STDOUT_FILENO);
+	while (n-- > 0)
+		print_entry(&out, idx, ids[n]);
+	out_flush(&out);
+	free(ids);
+	return (ret);
+}
+
+int	builtin_history(char **args, t_shell *shell)
+{
+	t_out	out;
+	int		i;
+
+	if (args[1] && ft_strcmp(args[1], "-S") == 0)
+	{
+		if (!args[2])
+			return (history_usage(args[1], ": option requires an argument\n"));
+		if (args[3])
+			return (history_usage(args[3], ": too many arguments\n"));
+		return (print_matches(&shell->history.index, args[2]));
+	}
+	if (args[1])
+		return (history_usage(args[1], ": invalid option\n"));
+	out_init(&out, STDOUT_FILENO);
+	i = 0;
+	while (i < shell->history.index.count)
+	{
+		print_entry(&out, &shell->history.index, i);
+		i++;
+	}
+	out_flush(&out);
+	return (0);
+}
@@ -1,27 +1,30 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   pwd.c                                              :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:38:21 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:38:21 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../includes/minishell.h"
-
-int	builtin_pwd(void)
-{
-	char	cwd[4096];
-
-	if (getcwd(cwd, sizeof(cwd)) == NULL)
-	{
-		perror("minishell: pwd");
-		return (1);
-	}
-	write(STDOUT_FILENO, cwd, ft_strlen(cwd));
-	write(STDOUT_FILENO, "\n", 1);
-	return (0);
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pwd.c                                              :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:38:21 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:38:21 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+int	builtin_pwd(void)
+{
+	char	cwd[4096];
+	t_out	out;
+
+	if (getcwd(cwd, sizeof(cwd)) == NULL)
+	{
+		perror("minishell: pwd");
+		return (1);
+	}
+	out_init(&out, STDOUT_FILENO);
+	out_str(&out, cwd);
+	out_put(&out, "\n", 1);
+	out_flush(&out);
+	return (0);
+}
@@ -1,61 +1,60 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   unset.c                                            :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:38:30 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:38:30 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../includes/minishell.h"
-
-static int	is_valid_unset_identifier(char *str)
-{
-	int	i;
-
-	if (!str || !*str)
-		return (0);
-	if (!((str[0] >= 'a' && str[0] <= 'z')
-			|| (str[0] >= 'A' && str[0] <= 'Z')
-			|| str[0] == '_'))
-		return (0);
-	i = 1;
-	while (str[i])
-	{
-		if (!((str[i] >= 'a' && str[i] <= 'z')
-				|| (str[i] >= 'A' && str[i] <= 'Z')
-				|| (str[i] >= '0' && str[i] <= '9')
-				|| str[i] == '_'))
-			return (0);
-		i++;
-	}
-	return (1);
-}
-
-int	builtin_unset(char **args, char ***env)
-{
-	int	i;
-	int	ret;
-
-	if (!args[1])
-		return (0);
-	i = 1;
-	ret = 0;
-	while (args[i])
-	{
-		if (!is_valid_unset_identifier(args[i]))
-		{
-			write(STDERR_FILENO, "minishell: unset: `", 19);
-			write(STDERR_FILENO, args[i], ft_strlen(args[i]));
-			write(STDERR_FILENO, "': not a valid identifier\n", 26);
-			ret = 1;
-		}
-		else
-			unset_env_value(env, args[i]);
-		i++;
-	}
-	return (ret);
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   unset.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:38:30 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:38:30 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static int	is_valid_unset_identifier(char *str)
+{
+	int	i;
+
+	if (!str || !*str)
+		return (0);
+	if (!((str[0] >= 'a' && str[0] <= 'z')
+			|| (str[0] >= 'A' && str[0] <= 'Z')
+			|| str[0] == '_'))
+		return (0);
+	i = 1;
+	while (str[i])
+	{
+		if (!((str[i] >= 'a' && str[i] <= 'z')
+				|| (str[i] >= 'A' && str[i] <= 'Z')
+				|| (str[i] >= '0' && str[i] <= '9')
+				|| str[i] == '_'))
+			return (0);
+		i++;
+	}
+	return (1);
+}
+
+int	builtin_unset(char **args, t_env *env)
+{
+	int	i;
+	int	ret;
+
+	if (!args[1])
+		return (0);
+	i = 1;
+	ret = 0;
+	while (args[i])
+	{
+		if (!is_valid_unset_identifier(args[i]))
+		{
+			print_error3("minishell: unset: `", args[i],
+				"': not a valid identifier\n");
+			ret = 1;
+		}
+		else
+			unset_env_value(env, args[i]);
+		i++;
+	}
+	return (ret);
+}
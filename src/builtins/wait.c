@@ -0,0 +1,108 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   wait.c                                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:31:05 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 17:31:05 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static int	wait_error(char *arg, int kind)
+{
+	if (kind == -1)
+	{
+		print_error3("minishell: wait: `", arg,
+			"': not a pid or valid job spec\n");
+		return (1);
+	}
+	if (kind == 0)
+		print_error3("minishell: wait: pid ", arg,
+			" is not a child of this shell\n");
+	else
+		print_error3("minishell: wait: ", arg, ": no such job\n");
+	return (127);
+}
+
+static int	parse_wait_arg(char *arg, int *value)
+{
+	int	job_spec;
+	int	i;
+
+	job_spec = (arg[0] == '%');
+	i = job_spec;
+	if (!arg[i])
+		return (-1);
+	while (arg[i])
+	{
+		if (!ft_isdigit(arg[i]))
+			return (-1);
+		i++;
+	}
+	*value = ft_atoi(arg + job_spec);
+	return (job_spec);
+}
+
+static int	wait_one(t_shell *shell, char *arg)
+{
+	t_job	*job;
+	int		value;
+	int		kind;
+	int		index;
+	int		status;
+
+	kind = parse_wait_arg(arg, &value);
+	if (kind == -1)
+		return (wait_error(arg, kind));
+	job = job_find(&shell->jobs, value, kind, &index);
+	if (!job && job_done_status(&shell->jobs, value, kind, &status))
+		return (status);
+	if (!job)
+		return (wait_error(arg, kind));
+	if (kind == 0)
+		status = job_wait(&shell->jobs, job, index);
+	else
+		status = job_wait(&shell->jobs, job, -1);
+	if (status == -1 && g_signal_received == SIGINT)
+		return (130);
+	if (kind == 0)
+		return (job_claim(&shell->jobs, job, index));
+	status = job_exit_code(job, index);
+	job_finish(&shell->jobs, job);
+	return (status);
+}
+
+static int	wait_all(t_shell *shell)
+{
+	while (shell->jobs.head)
+	{
+		if (job_wait(&shell->jobs, shell->jobs.head, -1) == -1
+			&& g_signal_received == SIGINT)
+			return (130);
+		job_finish(&shell->jobs, shell->jobs.head);
+	}
+	return (0);
+}
+
+int	builtin_wait(char **args, t_shell *shell)
+{
+	int	status;
+	int	i;
+
+	if (!args[1])
+		return (wait_all(shell));
+	status = 0;
+	i = 1;
+	while (args[i])
+	{
+		status = wait_one(shell, args[i]);
+		if (g_signal_received == SIGINT)
+			return (130);
+		i++;
+	}
+	return (status);
+}
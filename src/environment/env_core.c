@@ -1,124 +1,92 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   env_core.c                                         :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:38:51 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:38:51 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../includes/minishell.h"
-
-char	**copy_env(char **envp)
-{
-	char	**new_env;
-	int		i;
-	int		count;
-
-	if (!envp)
-		return (NULL);
-	count = 0;
-	while (envp[count])
-		count++;
-	new_env = malloc(sizeof(char *) * (count + 1));
-	if (!new_env)
-		return (NULL);
-	i = 0;
-	while (i < count)
-	{
-		new_env[i] = ft_strdup(envp[i]);
-		if (!new_env[i])
-		{
-			free_env(new_env);
-			return (NULL);
-		}
-		i++;
-	}
-	new_env[i] = NULL;
-	return (new_env);
-}
-
-void	free_env(char **env)
-{
-	int	i;
-
-	if (!env)
-		return ;
-	i = 0;
-	while (env[i])
-	{
-		free(env[i]);
-		i++;
-	}
-	free(env);
-}
-
-char	*get_env_value(char **env, char *key)
-{
-	int		i;
-	int		key_len;
-	char	*equal_sign;
-
-	if (!env || !key)
-		return (NULL);
-	key_len = ft_strlen(key);
-	i = 0;
-	while (env[i])
-	{
-		equal_sign = ft_strchr(env[i], '=');
-		if (equal_sign && (equal_sign - env[i]) == key_len
-			&& ft_strncmp(env[i], key, key_len) == 0)
-		{
-			return (equal_sign + 1);
-		}
-		i++;
-	}
-	return (NULL);
-}
-
-char	**realloc_env(char **env, int new_size)
-{
-	char	**new_env;
-	int		i;
-
-	new_env = malloc(sizeof(char *) * (new_size + 1));
-	if (!new_env)
-		return (NULL);
-	i = 0;
-	while (env[i] && i < new_size)
-	{
-		new_env[i] = env[i];
-		i++;
-	}
-	while (i <= new_size)
-	{
-		new_env[i] = NULL;
-		i++;
-	}
-	free(env);
-	return (new_env);
-}
-
-int	find_env_index(char **env, char *key)
-{
-	int		i;
-	int		key_len;
-	char	*equal_sign;
-
-	if (!env || !key)
-		return (-1);
-	key_len = ft_strlen(key);
-	i = 0;
-	while (env[i])
-	{
-		equal_sign = ft_strchr(env[i], '=');
-		if (equal_sign && (equal_sign - env[i]) == key_len
-			&& ft_strncmp(env[i], key, key_len) == 0)
-			return (i);
-		i++;
-	}
-	return (-1);
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_core.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:38:51 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:38:51 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static void	init_env_fields(t_env *env)
+{
+	env->vars = NULL;
+	env->count = 0;
+	env->live = 0;
+	env->capacity = 0;
+	env->table = NULL;
+	env->table_size = 0;
+	env->table_used = 0;
+	env->envp = NULL;
+	env->envp_gen = 0;
+	env->generation = 1;
+	env->path_gen = 0;
+}
+
+t_env	*env_create(char **envp)
+{
+	t_env	*env;
+	char	*entry;
+	int		i;
+
+	env = malloc(sizeof(t_env));
+	if (!env)
+		return (NULL);
+	init_env_fields(env);
+	i = 0;
+	while (envp && envp[i])
+	{
+		entry = ft_strdup(envp[i]);
+		if (!entry || env_put_entry(env, entry))
+		{
+			env_destroy(env);
+			return (NULL);
+		}
+		i++;
+	}
+	if (!env->table && env_table_rebuild(env))
+	{
+		env_destroy(env);
+		return (NULL);
+	}
+	return (env);
+}
+
+void	env_destroy(t_env *env)
+{
+	int	i;
+
+	if (!env)
+		return ;
+	i = 0;
+	while (i < env->count)
+	{
+		free(env->vars[i]);
+		i++;
+	}
+	free(env->vars);
+	free(env->table);
+	free(env->envp);
+	free(env);
+}
+
+char	*get_env_value(t_env *env, char *key)
+{
+	if (!key)
+		return (NULL);
+	return (get_env_value_len(env, key, ft_strlen(key)));
+}
+
+int	find_env_index(t_env *env, char *key)
+{
+	int	slot;
+
+	if (!env || !key || !env->table)
+		return (-1);
+	slot = env_table_lookup(env, key, ft_strlen(key));
+	return (env->table[slot]);
+}
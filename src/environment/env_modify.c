@@ -1,89 +1,101 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   env_modify.c                                       :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:39:00 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:39:00 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../includes/minishell.h"
-
-static char	*create_env_entry(char *key, char *value)
-{
-	char	*new_entry;
-
-	new_entry = malloc(ft_strlen(key) + ft_strlen(value) + 2);
-	if (!new_entry)
-		return (NULL);
-	ft_strcpy(new_entry, key);
-	ft_strcat(new_entry, "=");
-	if (value)
-		ft_strcat(new_entry, value);
-	return (new_entry);
-}
-
-static int	update_existing_env(char ***env, char *new_entry, int index)
-{
-	free((*env)[index]);
-	(*env)[index] = new_entry;
-	return (0);
-}
-
-static int	add_new_env_entry(char ***env, char *new_entry)
-{
-	char	**new_env;
-	int		count;
-
-	count = count_string_array(*env);
-	new_env = realloc_env(*env, count + 1);
-	if (!new_env)
-	{
-		free(new_entry);
-		return (1);
-	}
-	new_env[count] = new_entry;
-	new_env[count + 1] = NULL;
-	*env = new_env;
-	return (0);
-}
-
-int	set_env_value(char ***env, char *key, char *value)
-{
-	char	*new_entry;
-	int		index;
-
-	if (!env || !*env || !key)
-		return (1);
-	new_entry = create_env_entry(key, value);
-	if (!new_entry)
-		return (1);
-	index = find_env_index(*env, key);
-	if (index >= 0)
-		return (update_existing_env(env, new_entry, index));
-	return (add_new_env_entry(env, new_entry));
-}
-
-int	unset_env_value(char ***env, char *key)
-{
-	int	index;
-	int	i;
-
-	if (!env || !*env || !key)
-		return (1);
-	index = find_env_index(*env, key);
-	if (index < 0)
-		return (0);
-	free((*env)[index]);
-	i = index;
-	while ((*env)[i + 1])
-	{
-		(*env)[i] = (*env)[i + 1];
-		i++;
-	}
-	(*env)[i] = NULL;
-	return (0);
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_modify.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:39:00 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:39:00 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static char	*create_env_entry(char *key, char *value)
+{
+	char	*new_entry;
+
+	new_entry = malloc(ft_strlen(key) + ft_strlen(value) + 2);
+	if (!new_entry)
+		return (NULL);
+	ft_strcpy(new_entry, key);
+	ft_strcat(new_entry, "=");
+	if (value)
+		ft_strcat(new_entry, value);
+	return (new_entry);
+}
+
+static int	add_new_env_entry(t_env *env, char *new_entry, int slot)
+{
+	if (env->count == env->capacity && env_grow_vars(env))
+		return (1);
+	env->vars[env->count] = new_entry;
+	env->table[slot] = env->count;
+	env->count++;
+	env->live++;
+	env->table_used++;
+	return (0);
+}
+
+int	env_put_entry(t_env *env, char *new_entry)
+{
+	int	len;
+	int	slot;
+
+	if ((env->table_used + 1) * 2 > env->table_size && env_table_rebuild(env))
+	{
+		free(new_entry);
+		return (1);
+	}
+	len = env_key_len(new_entry);
+	if (len == 4 && ft_strncmp(new_entry, "PATH", 4) == 0)
+		env->path_gen++;
+	env->generation++;
+	slot = env_table_lookup(env, new_entry, len);
+	if (env->table[slot] >= 0)
+	{
+		free(env->vars[env->table[slot]]);
+		env->vars[env->table[slot]] = new_entry;
+		return (0);
+	}
+	if (add_new_env_entry(env, new_entry, slot))
+	{
+		free(new_entry);
+		return (1);
+	}
+	return (0);
+}
+
+int	set_env_value(t_env *env, char *key, char *value)
+{
+	char	*new_entry;
+
+	if (!env || !key)
+		return (1);
+	new_entry = create_env_entry(key, value);
+	if (!new_entry)
+		return (1);
+	return (env_put_entry(env, new_entry));
+}
+
+int	unset_env_value(t_env *env, char *key)
+{
+	int	slot;
+	int	index;
+
+	if (!env || !key || !env->table)
+		return (1);
+	slot = env_table_lookup(env, key, ft_strlen(key));
+	index = env->table[slot];
+	if (index < 0)
+		return (0);
+	if (ft_strcmp(key, "PATH") == 0)
+		env->path_gen++;
+	free(env->vars[index]);
+	env->vars[index] = NULL;
+	env->table[slot] = -2;
+	env->live--;
+	env->generation++;
+	return (0);
+}
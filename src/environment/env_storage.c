@@ -0,0 +1,77 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_storage.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:40:02 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 15:40:02 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+int	env_grow_vars(t_env *env)
+{
+	char	**new_vars;
+	int		new_capacity;
+	int		i;
+
+	new_capacity = env->capacity * 2;
+	if (new_capacity < 32)
+		new_capacity = 32;
+	new_vars = malloc(sizeof(char *) * new_capacity);
+	if (!new_vars)
+		return (1);
+	i = 0;
+	while (i < env->count)
+	{
+		new_vars[i] = env->vars[i];
+		i++;
+	}
+	free(env->vars);
+	env->vars = new_vars;
+	env->capacity = new_capacity;
+	return (0);
+}
+
+void	env_compact_vars(t_env *env)
+{
+	int	i;
+	int	j;
+
+	i = 0;
+	j = 0;
+	while (i < env->count)
+	{
+		if (env->vars[i])
+			env->vars[j++] = env->vars[i];
+		i++;
+	}
+	env->count = j;
+}
+
+char	**env_to_envp(t_env *env)
+{
+	int	i;
+	int	j;
+
+	if (env->envp && env->envp_gen == env->generation)
+		return (env->envp);
+	free(env->envp);
+	env->envp = malloc(sizeof(char *) * (env->live + 1));
+	if (!env->envp)
+		return (NULL);
+	i = 0;
+	j = 0;
+	while (i < env->count)
+	{
+		if (env->vars[i])
+			env->envp[j++] = env->vars[i];
+		i++;
+	}
+	env->envp[j] = NULL;
+	env->envp_gen = env->generation;
+	return (env->envp);
+}
@@ -0,0 +1,102 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   env_table.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 15:12:40 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 15:12:40 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static unsigned int	env_hash(char *key, int len)
+{
+	unsigned int	h;
+	int				i;
+
+	h = 2166136261u;
+	i = 0;
+	while (i < len)
+	{
+		h = (h ^ (unsigned char)key[i]) * 16777619u;
+		i++;
+	}
+	return (h);
+}
+
+int	env_key_len(char *entry)
+{
+	int	len;
+
+	len = 0;
+	while (entry[len] && entry[len] != '=')
+		len++;
+	return (len);
+}
+
+int	env_table_lookup(t_env *env, char *key, int len)
+{
+	unsigned int	mask;
+	unsigned int	slot;
+	int				index;
+
+	mask = env->table_size - 1;
+	slot = env_hash(key, len) & mask;
+	while (env->table[slot] != -1)
+	{
+		index = env->table[slot];
+		if (index >= 0 && env_key_len(env->vars[index]) == len
+			&& ft_strncmp(env->vars[index], key, len) == 0)
+			return (slot);
+		slot = (slot + 1) & mask;
+	}
+	return (slot);
+}
+
+char	*get_env_value_len(t_env *env, char *key, int len)
+{
+	int		index;
+	char	*entry;
+
+	if (!env || !env->table || len <= 0)
+		return (NULL);
+	index = env->table[env_table_lookup(env, key, len)];
+	if (index < 0)
+		return (NULL);
+	entry = env->vars[index];
+	if (entry[len] != '=')
+		return (NULL);
+	return (entry + len + 1);
+}
+
+int	env_table_rebuild(t_env *env)
+{
+	int	size;
+	int	i;
+
+	env_compact_vars(env);
+	size = 16;
+	while (size < env->live * 4)
+		size *= 2;
+	free(env->table);
+	env->table_size = 0;
+	env->table = malloc(sizeof(int) * size);
+	if (!env->table)
+		return (1);
+	env->table_size = size;
+	i = 0;
+	while (i < size)
+		env->table[i++] = -1;
+	i = 0;
+	while (i < env->count)
+	{
+		env->table[env_table_lookup(env, env->vars[i],
+				env_key_len(env->vars[i]))] = i;
+		i++;
+	}
+	env->table_used = env->count;
+	return (0);
+}
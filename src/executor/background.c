@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   background.c                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:15:48 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 17:15:48 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static void	background_begin(t_background *bg)
+{
+	struct sigaction	ignore;
+	int					null_fd;
+
+	sigemptyset(&ignore.sa_mask);
+	ignore.sa_handler = SIG_IGN;
+	ignore.sa_flags = 0;
+	sigaction(SIGINT, &ignore, &bg->sigint);
+	sigaction(SIGQUIT, &ignore, &bg->sigquit);
+	bg->saved_stdin = fcntl(STDIN_FILENO, F_DUPFD_CLOEXEC, 0);
+	null_fd = open("/dev/null", O_RDONLY);
+	if (null_fd != -1)
+	{
+		dup2(null_fd, STDIN_FILENO);
+		close(null_fd);
+	}
+}
+
+static void	background_end(t_background *bg)
+{
+	if (bg->saved_stdin != -1)
+	{
+		dup2(bg->saved_stdin, STDIN_FILENO);
+		close(bg->saved_stdin);
+	}
+	sigaction(SIGINT, &bg->sigint, NULL);
+	sigaction(SIGQUIT, &bg->sigquit, NULL);
+}
+
+int	execute_background(t_cmd *cmd_list, t_shell *shell)
+{
+	t_background	bg;
+
+	background_begin(&bg);
+	if (!cmd_list->next)
+		execute_simple_command(cmd_list, shell);
+	else
+		execute_pipeline(cmd_list, shell);
+	background_end(&bg);
+	return (0);
+}
@@ -0,0 +1,95 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   command_hash.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:02:11 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 14:02:11 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static unsigned int	hash_command_name(char *name)
+{
+	unsigned int	h;
+
+	h = 5381;
+	while (*name)
+	{
+		h = h * 33 + (unsigned char)*name;
+		name++;
+	}
+	return (h % CMD_HASH_SIZE);
+}
+
+void	hash_init(t_cmd_hash *table)
+{
+	int	i;
+
+	i = 0;
+	while (i < CMD_HASH_SIZE)
+	{
+		table->buckets[i] = NULL;
+		i++;
+	}
+	table->path_gen = -1;
+}
+
+t_hash_entry	*hash_find(t_cmd_hash *table, char *name)
+{
+	t_hash_entry	*entry;
+
+	entry = table->buckets[hash_command_name(name)];
+	while (entry && ft_strcmp(entry->name, name) != 0)
+		entry = entry->next;
+	return (entry);
+}
+
+t_hash_entry	*hash_insert(t_cmd_hash *table, char *name, char *path)
+{
+	t_hash_entry	*entry;
+	unsigned int	index;
+
+	hash_remove(table, name);
+	entry = malloc(sizeof(t_hash_entry));
+	if (!entry)
+		return (NULL);
+	entry->name = ft_strdup(name);
+	entry->path = ft_strdup(path);
+	if (!entry->name || !entry->path)
+	{
+		free(entry->name);
+		free(entry->path);
+		free(entry);
+		return (NULL);
+	}
+	entry->hits = 0;
+	index = hash_command_name(name);
+	entry->next = table->buckets[index];
+	table->buckets[index] = entry;
+	return (entry);
+}
+
+void	hash_remove(t_cmd_hash *table, char *name)
+{
+	t_hash_entry	**link;
+	t_hash_entry	*entry;
+
+	link = &table->buckets[hash_command_name(name)];
+	while (*link)
+	{
+		entry = *link;
+		if (ft_strcmp(entry->name, name) == 0)
+		{
+			*link = entry->next;
+			free(entry->name);
+			free(entry->path);
+			free(entry);
+			return ;
+		}
+		link = &entry->next;
+	}
+}
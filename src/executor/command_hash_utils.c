@@ -0,0 +1,44 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   command_hash_utils.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:09:37 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 14:09:37 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+void	hash_clear(t_cmd_hash *table)
+{
+	t_hash_entry	*entry;
+	t_hash_entry	*next;
+	int				i;
+
+	i = 0;
+	while (i < CMD_HASH_SIZE)
+	{
+		entry = table->buckets[i];
+		while (entry)
+		{
+			next = entry->next;
+			free(entry->name);
+			free(entry->path);
+			free(entry);
+			entry = next;
+		}
+		table->buckets[i] = NULL;
+		i++;
+	}
+}
+
+void	hash_sync_path(t_cmd_hash *table, t_env *env)
+{
+	if (table->path_gen == env->path_gen)
+		return ;
+	hash_clear(table);
+	table->path_gen = env->path_gen;
+}
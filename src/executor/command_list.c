@@ -0,0 +1,49 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   command_list.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:31:18 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 14:31:18 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static t_cmd_list	*next_to_run(t_cmd_list *list, int status)
+{
+	int	op;
+
+	op = list->op;
+	list = list->next;
+	while (list && ((op == CY2_AND && status != 0)
+			|| (op == CY2_OR && status == 0)))
+	{
+		op = list->op;
+		list = list->next;
+	}
+	return (list);
+}
+
+int	execute_list(t_cmd_list *list, t_shell *shell)
+{
+	int	background;
+
+	background = shell->background;
+	while (list && !shell->should_exit)
+	{
+		shell->background = background && !list->next;
+		if (!list->cmds && prepare_pipeline(list, shell))
+			break ;
+		if (check_last_cmd_args_null(list->cmds))
+			break ;
+		shell->last_exit_status = execute_command_line(list->cmds, shell);
+		if (g_signal_received == SIGINT)
+			break ;
+		list = next_to_run(list, shell->last_exit_status);
+	}
+	shell->background = background;
+	return (shell->last_exit_status);
+}
@@ -1,90 +1,106 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   executor_builtins.c                                :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:39:18 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:39:18 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../includes/minishell.h"
-
-int	is_builtin(char *cmd)
-{
-	if (!cmd)
-		return (0);
-	if (ft_strcmp(cmd, "echo") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "cd") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "pwd") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "export") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "unset") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "env") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "exit") == 0)
-		return (1);
-	return (0);
-}
-
-int	execute_builtin(t_cmd *cmd, t_shell *shell)
-{
-	if (ft_strcmp(cmd->args[0], "echo") == 0)
-		return (builtin_echo(cmd->args));
-	if (ft_strcmp(cmd->args[0], "cd") == 0)
-		return (builtin_cd(cmd->args, &shell->env));
-	if (ft_strcmp(cmd->args[0], "pwd") == 0)
-		return (builtin_pwd());
-	if (ft_strcmp(cmd->args[0], "export") == 0)
-		return (builtin_export(cmd->args, &shell->env));
-	if (ft_strcmp(cmd->args[0], "unset") == 0)
-		return (builtin_unset(cmd->args, &shell->env));
-	if (ft_strcmp(cmd->args[0], "env") == 0)
-		return (builtin_env(shell->env));
-	if (ft_strcmp(cmd->args[0], "exit") == 0)
-		return (builtin_exit(cmd->args, shell));
-	return (0);
-}
-
-int	must_run_in_parent(char *cmd)
-{
-	if (ft_strcmp(cmd, "export") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "unset") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "cd") == 0)
-		return (1);
-	if (ft_strcmp(cmd, "exit") == 0)
-		return (1);
-	return (0);
-}
-
-int	execute_builtin_with_redirs(t_cmd *cmd, t_shell *shell)
-{
-	int	saved_stdout;
-	int	saved_stdin;
-	int	ret;
-
-	saved_stdout = dup(STDOUT_FILENO);
-	saved_stdin = dup(STDIN_FILENO);
-	if (saved_stdout == -1 || saved_stdin == -1)
-		return (1);
-	if (setup_redirections(cmd->redirs) == -1)
-	{
-		close(saved_stdout);
-		close(saved_stdin);
-		return (1);
-	}
-	ret = execute_builtin(cmd, shell);
-	dup2(saved_stdout, STDOUT_FILENO);
-	dup2(saved_stdin, STDIN_FILENO);
-	close(saved_stdout);
-	close(saved_stdin);
-	return (ret);
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   executor_builtins.c                                :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:39:18 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:39:18 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+int	is_builtin(char *cmd)
+{
+	if (!cmd)
+		return (0);
+	if (ft_strcmp(cmd, "echo") == 0)
+		return (1);
+	if (ft_strcmp(cmd, "cd") == 0)
+		return (1);
+	if (ft_strcmp(cmd, "pwd") == 0)
+		return (1);
+	if (ft_strcmp(cmd, "export") == 0)
+		return (1);
+	if (ft_strcmp(cmd, "unset") == 0)
+		return (1);
+	if (ft_strcmp(cmd, "env") == 0)
+		return (1);
+	if (ft_strcmp(cmd, "exit") == 0)
+		return (1);
+	if (ft_strcmp(cmd, "hash") == 0)
+		return (1);
+	if (ft_strcmp(cmd, "wait") == 0)
+		return (1);
+	if (ft_strcmp(cmd, "history") == 0)
+		return (1);
+	return (0);
+}
+
+int	execute_builtin(t_cmd *cmd, t_shell *shell)
+{
+	if (ft_strcmp(cmd->args[0], "echo") == 0)
+		return (builtin_echo(cmd->args));
+	if (ft_strcmp(cmd->args[0], "cd") == 0)
+		return (builtin_cd(cmd->args, shell->env));
+	if (ft_strcmp(cmd->args[0], "pwd") == 0)
+		return (builtin_pwd());
+	if (ft_strcmp(cmd->args[0], "export") == 0)
+		return (builtin_export(cmd->args, shell->env));
+	if (ft_strcmp(cmd->args[0], "unset") == 0)
+		return (builtin_unset(cmd->args, shell->env));
+	if (ft_strcmp(cmd->args[0], "env") == 0)
+		return (builtin_env(shell->env));
+	if (ft_strcmp(cmd->args[0], "exit") == 0)
+		return (builtin_exit(cmd->args, shell));
+	if (ft_strcmp(cmd->args[0], "hash") == 0)
+		return (builtin_hash(cmd->args, shell));
+	if (ft_strcmp(cmd->args[0], "wait") == 0)
+		return (builtin_wait(cmd->args, shell));
+	if (ft_strcmp(cmd->args[0], "history") == 0)
+		return (builtin_history(cmd->args, shell));
+	return (0);
+}
+
+int	must_run_in_parent(char *cmd)
+{
+	if (ft_strcmp(cmd, "export") == 0)
+		return (1);
+	if (ft_strcmp(cmd, "unset") == 0)
+		return (1);
+	if (ft_strcmp(cmd, "cd") == 0)
+		return (1);
+	if (ft_strcmp(cmd, "exit") == 0)
+		return (1);
+	if (ft_strcmp(cmd, "hash") == 0)
+		return (1);
+	if (ft_strcmp(cmd, "wait") == 0)
+		return (1);
+	return (0);
+}
+
+int	execute_builtin_with_redirs(t_cmd *cmd, t_shell *shell)
+{
+	int	saved_stdout;
+	int	saved_stdin;
+	int	ret;
+
+	saved_stdout = dup(STDOUT_FILENO);
+	saved_stdin = dup(STDIN_FILENO);
+	if (saved_stdout == -1 || saved_stdin == -1)
+		return (1);
+	if (setup_redirections(cmd->redirs) == -1)
+	{
+		close(saved_stdout);
+		close(saved_stdin);
+		return (1);
+	}
+	ret = execute_builtin(cmd, shell);
+	dup2(saved_stdout, STDOUT_FILENO);
+	dup2(saved_stdin, STDIN_FILENO);
+	close(saved_stdout);
+	close(saved_stdin);
+	return (ret);
+}
@@ -1,124 +1,124 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   heredoc.c                                          :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:39:37 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:39:37 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../includes/minishell.h"
-
-static void	create_temp_filename(char *buffer, int counter)
-{
-	char	*base;
-	int		i;
-	int		temp;
-
-	base = "/tmp/minishell_heredoc_";
-	i = 0;
-	while (base[i])
-	{
-		buffer[i] = base[i];
-		i++;
-	}
-	temp = counter;
-	if (temp == 0)
-		buffer[i++] = '0';
-	else
-	{
-		if (temp >= 10)
-			buffer[i++] = (temp / 10) + '0';
-		buffer[i++] = (temp % 10) + '0';
-	}
-	buffer[i] = '\0';
-}
-
-static int	handle_heredoc_signal_cleanup(int temp_fd, char *temp_filename)
-{
-	if (g_signal_received == SIGINT)
-	{
-		g_signal_received = 0;
-		close(temp_fd);
-		unlink(temp_filename);
-		setup_signals();
-		return (-1);
-	}
-	return (0);
-}
-
-static int	process_heredoc_lines(int temp_fd, char *delimiter,
-								char *temp_filename)
-{
-	char	*line;
-
-	while (1)
-	{
-		line = readline("> ");
-		if (!line || g_signal_received == SIGINT)
-		{
-			if (handle_heredoc_signal_cleanup(temp_fd, temp_filename) == -1)
-				return (-1);
-			break ;
-		}
-		if (ft_strcmp(line, delimiter) == 0)
-		{
-			free(line);
-			break ;
-		}
-		write(temp_fd, line, ft_strlen(line));
-		write(temp_fd, "\n", 1);
-		free(line);
-	}
-	return (0);
-}
-
-static int	process_single_heredoc(t_redir *redir, char *temp_filename,
-								int *heredoc_count)
-{
-	int	temp_fd;
-
-	create_temp_filename(temp_filename, *heredoc_count);
-	(*heredoc_count)++;
-	temp_fd = open(temp_filename, O_WRONLY | O_CREAT | O_TRUNC, 0600);
-	if (temp_fd == -1)
-		return (-1);
-	setup_heredoc_signals();
-	if (process_heredoc_lines(temp_fd, redir->file, temp_filename) == -1)
-		return (-1);
-	close(temp_fd);
-	setup_signals();
-	free(redir->file);
-	redir->file = ft_strdup(temp_filename);
-	redir->type = 0;
-	return (0);
-}
-
-int	preprocess_heredocs(t_cmd *cmd_list)
-{
-	t_cmd		*current;
-	t_redir		*redir;
-	char		temp_filename[64];
-	static int	heredoc_count = 0;
-
-	current = cmd_list;
-	while (current)
-	{
-		redir = current->redirs;
-		while (redir)
-		{
-			if (redir->type == 3)
-			{
-				if (process_single_heredoc(redir, temp_filename,
-						&heredoc_count) == -1)
-					return (-1);
-			}
-			redir = redir->next;
-		}
-		current = current->next;
-	}
-	return (0);
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:39:37 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:39:37 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static int	heredoc_append(t_heredoc *doc, char *line)
+{
+	size_t	len;
+	char	*grown;
+
+	len = ft_strlen(line);
+	if (doc->len + len + 1 > doc->cap)
+	{
+		doc->cap = (doc->len + len + 1) * 2;
+		grown = malloc(doc->cap);
+		if (!grown)
+			return (-1);
+		ft_memcpy(grown, doc->data, doc->len);
+		free(doc->data);
+		doc->data = grown;
+	}
+	ft_memcpy(doc->data + doc->len, line, len);
+	doc->data[doc->len + len] = '\n';
+	doc->len += len + 1;
+	return (0);
+}
+
+static int	heredoc_collect(t_heredoc *doc, char *delimiter)
+{
+	char	*line;
+	int		result;
+
+	result = 0;
+	while (result == 0)
+	{
+		if (!is_batch_input())
+			write(STDERR_FILENO, "> ", 2);
+		line = read_input_line("");
+		if (g_signal_received == SIGINT)
+		{
+			g_signal_received = 0;
+			free(line);
+			return (-1);
+		}
+		if (!line || ft_strcmp(line, delimiter) == 0)
+			result = 1;
+		else if (heredoc_append(doc, line) == -1)
+			result = -1;
+		free(line);
+	}
+	return (result);
+}
+
+static int	read_heredoc_body(char *delimiter)
+{
+	t_heredoc	doc;
+	int			saved_stdin;
+	int			fd;
+
+	doc.data = NULL;
+	doc.len = 0;
+	doc.cap = 0;
+	fd = -1;
+	saved_stdin = dup(STDIN_FILENO);
+	setup_heredoc_signals();
+	if (heredoc_collect(&doc, delimiter) == 1)
+		fd = heredoc_store(doc.data, doc.len);
+	setup_signals();
+	if (fd == -1 && saved_stdin != -1)
+		dup2(saved_stdin, STDIN_FILENO);
+	if (saved_stdin != -1)
+		close(saved_stdin);
+	free(doc.data);
+	return (fd);
+}
+
+int	preprocess_heredocs(t_cmd *cmd_list)
+{
+	t_redir	*redir;
+
+	while (cmd_list)
+	{
+		redir = cmd_list->redirs;
+		while (redir)
+		{
+			if (redir->type == 3)
+			{
+				redir->fd = read_heredoc_body(redir->file);
+				if (redir->fd == -1)
+					return (-1);
+			}
+			redir = redir->next;
+		}
+		cmd_list = cmd_list->next;
+	}
+	return (0);
+}
+
+void	close_heredocs(t_cmd *cmd_list)
+{
+	t_redir	*redir;
+
+	while (cmd_list)
+	{
+		redir = cmd_list->redirs;
+		while (redir)
+		{
+			if (redir->fd != -1)
+				close(redir->fd);
+			redir->fd = -1;
+			redir = redir->next;
+		}
+		cmd_list = cmd_list->next;
+	}
+}
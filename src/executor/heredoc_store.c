@@ -0,0 +1,66 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   heredoc_store.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:12:40 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 14:12:40 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static int	write_body(int fd, char *data, size_t len)
+{
+	ssize_t	written;
+
+	while (len > 0)
+	{
+		written = write(fd, data, len);
+		if (written == -1 && errno != EINTR)
+			return (-1);
+		if (written > 0)
+		{
+			data += written;
+			len -= written;
+		}
+	}
+	return (0);
+}
+
+int	open_memory_file(void)
+{
+	int	fd;
+
+	fd = memfd_create("minishell_heredoc", MFD_CLOEXEC);
+	if (fd == -1)
+		fd = open("/tmp", O_TMPFILE | O_RDWR | O_CLOEXEC, 0600);
+	return (fd);
+}
+
+int	heredoc_store(char *data, size_t len)
+{
+	int	pipe_fd[2];
+	int	fd;
+
+	if (len <= PIPE_BUF)
+	{
+		if (create_pipe(pipe_fd) == -1)
+			return (-1);
+		write_body(pipe_fd[1], data, len);
+		close(pipe_fd[1]);
+		return (pipe_fd[0]);
+	}
+	fd = open_memory_file();
+	if (fd == -1 || write_body(fd, data, len) == -1
+		|| lseek(fd, 0, SEEK_SET) == -1)
+	{
+		perror("minishell: heredoc");
+		if (fd != -1)
+			close(fd);
+		return (-1);
+	}
+	return (fd);
+}
@@ -1,37 +1,62 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   path_search.c                                      :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:39:58 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:39:58 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../includes/minishell.h"
-
-char	*search_in_path(char *cmd, char **env)
-{
-	char	**paths;
-	char	*cmd_path;
-	int		i;
-
-	paths = get_paths_from_env(env);
-	if (!paths)
-		return (NULL);
-	i = 0;
-	while (paths[i])
-	{
-		cmd_path = check_path(paths[i], cmd);
-		if (cmd_path)
-		{
-			free_string_array(paths);
-			return (cmd_path);
-		}
-		i++;
-	}
-	free_string_array(paths);
-	return (NULL);
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   path_search.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:39:58 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:39:58 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+char	*search_in_path(char *cmd, t_env *env)
+{
+	char	**paths;
+	char	*cmd_path;
+	int		i;
+
+	paths = get_paths_from_env(env);
+	if (!paths)
+		return (NULL);
+	i = 0;
+	while (paths[i])
+	{
+		cmd_path = check_path(paths[i], cmd);
+		if (cmd_path)
+		{
+			free_string_array(paths);
+			return (cmd_path);
+		}
+		i++;
+	}
+	free_string_array(paths);
+	return (NULL);
+}
+
+char	*resolve_command(char *cmd, t_shell *shell)
+{
+	t_hash_entry	*entry;
+	char			*cmd_path;
+
+	if (!cmd || !*cmd || ft_strchr(cmd, '/'))
+		return (find_command_path(cmd, shell->env));
+	hash_sync_path(&shell->cmd_hash, shell->env);
+	entry = hash_find(&shell->cmd_hash, cmd);
+	if (entry && is_executable(entry->path))
+	{
+		entry->hits++;
+		return (ft_strdup(entry->path));
+	}
+	if (entry)
+		hash_remove(&shell->cmd_hash, cmd);
+	cmd_path = search_in_path(cmd, shell->env);
+	if (!cmd_path)
+		return (NULL);
+	entry = hash_insert(&shell->cmd_hash, cmd, cmd_path);
+	if (entry)
+		entry->hits = 1;
+	return (cmd_path);
+}
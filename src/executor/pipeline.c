@@ -1,88 +1,88 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   pipeline.c                                         :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:40:12 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:40:12 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../includes/minishell.h"
-
-static int	count_commands(t_cmd *cmd_list)
-{
-	t_cmd	*current;
-	int		count;
-
-	count = 0;
-	current = cmd_list;
-	while (current)
-	{
-		count++;
-		current = current->next;
-	}
-	return (count);
-}
-
-static int	execute_pipeline_loop(t_cmd *cmd_list, t_shell *shell,
-								t_exec *exec, pid_t *pids)
-{
-	t_cmd			*current;
-	t_pipeline_data	data;
-
-	current = cmd_list;
-	data.pids = pids;
-	data.index = 0;
-	while (current)
-	{
-		if (execute_and_manage_pipes(current, shell, exec, &data) == -1)
-			return (-1);
-		current = current->next;
-		data.index++;
-	}
-	return (data.index);
-}
-
-static int	wait_all_processes(pid_t *pids, int cmd_count)
-{
-	int	i;
-	int	status;
-
-	i = 0;
-	status = 0;
-	while (i < cmd_count)
-	{
-		waitpid(pids[i], &status, 0);
-		i++;
-	}
-	if (WIFSIGNALED(status))
-		return (128 + WTERMSIG(status));
-	return (WEXITSTATUS(status));
-}
-
-int	execute_pipeline(t_cmd *cmd_list, t_shell *shell)
-{
-	t_exec	exec;
-	pid_t	*pids;
-	int		cmd_count;
-	int		result;
-
-	if (preprocess_heredocs(cmd_list) == -1)
-		return (1);
-	cmd_count = count_commands(cmd_list);
-	pids = malloc(sizeof(pid_t) * cmd_count);
-	if (!pids)
-		return (1);
-	exec.prev_pipe = -1;
-	if (execute_pipeline_loop(cmd_list, shell, &exec, pids) == -1)
-	{
-		free(pids);
-		return (1);
-	}
-	result = wait_all_processes(pids, cmd_count);
-	free(pids);
-	return (result);
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipeline.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:40:12 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:40:12 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static int	count_commands(t_cmd *cmd_list)
+{
+	t_cmd	*current;
+	int		count;
+
+	count = 0;
+	current = cmd_list;
+	while (current)
+	{
+		count++;
+		current = current->next;
+	}
+	return (count);
+}
+
+static int	execute_pipeline_loop(t_cmd *cmd_list, t_shell *shell,
+								t_exec *exec, t_pipeline_data *data)
+{
+	t_cmd	*current;
+
+	current = cmd_list;
+	data->index = 0;
+	while (current)
+	{
+		if (execute_and_manage_pipes(current, shell, exec, data) == -1)
+			return (-1);
+		current = current->next;
+		data->index++;
+	}
+	return (data->index);
+}
+
+static int	wait_all_processes(t_shell *shell, t_stage *stages, int cmd_count)
+{
+	t_job	*job;
+	int		status;
+	int		i;
+
+	job = job_start(&shell->jobs, cmd_count);
+	if (!job)
+		return (1);
+	i = 0;
+	while (i < cmd_count)
+	{
+		if (stages[i].pid > 0)
+			job_track(job, i, stages[i].pid);
+		i++;
+	}
+	status = job_settle(shell, job, cmd_count - 1);
+	if (stages[cmd_count - 1].pid == 0)
+		status = stages[cmd_count - 1].status;
+	return (status);
+}
+
+int	execute_pipeline(t_cmd *cmd_list, t_shell *shell)
+{
+	t_exec			exec;
+	t_pipeline_data	data;
+	int				cmd_count;
+	int				result;
+
+	cmd_count = count_commands(cmd_list);
+	data.stages = malloc(sizeof(t_stage) * cmd_count);
+	if (!data.stages)
+		return (1);
+	prepare_stages(cmd_list, shell, data.stages);
+	exec.prev_pipe = -1;
+	result = 1;
+	if (execute_pipeline_loop(cmd_list, shell, &exec, &data) != -1)
+		result = wait_all_processes(shell, data.stages, cmd_count);
+	release_stages(data.stages, cmd_count);
+	free(data.stages);
+	return (result);
+}
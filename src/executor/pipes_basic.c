@@ -1,49 +1,51 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   pipes_basic.c                                      :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:40:20 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:40:20 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../includes/minishell.h"
-
-int	create_pipe(int pipe_fd[2])
-{
-	if (pipe(pipe_fd) == -1)
-	{
-		perror("minishell: pipe");
-		return (-1);
-	}
-	return (0);
-}
-
-void	setup_pipe_child(int pipe_fd[2], int prev_pipe, int is_last)
-{
-	if (prev_pipe != -1)
-	{
-		dup2(prev_pipe, STDIN_FILENO);
-		close(prev_pipe);
-	}
-	if (!is_last)
-	{
-		close(pipe_fd[0]);
-		dup2(pipe_fd[1], STDOUT_FILENO);
-		close(pipe_fd[1]);
-	}
-}
-
-void	close_pipe_parent(int pipe_fd[2], int *prev_pipe)
-{
-	if (*prev_pipe != -1)
-		close(*prev_pipe);
-	if (pipe_fd && pipe_fd[0] != -1)
-	{
-		close(pipe_fd[1]);
-		*prev_pipe = pipe_fd[0];
-	}
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pipes_basic.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:40:20 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:40:20 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+int	create_pipe(int pipe_fd[2])
+{
+	if (pipe(pipe_fd) == -1)
+	{
+		perror("minishell: pipe");
+		return (-1);
+	}
+	fcntl(pipe_fd[0], F_SETFD, FD_CLOEXEC);
+	fcntl(pipe_fd[1], F_SETFD, FD_CLOEXEC);
+	return (0);
+}
+
+void	setup_pipe_child(int pipe_fd[2], int prev_pipe, int is_last)
+{
+	if (prev_pipe != -1)
+	{
+		dup2(prev_pipe, STDIN_FILENO);
+		close(prev_pipe);
+	}
+	if (!is_last)
+	{
+		close(pipe_fd[0]);
+		dup2(pipe_fd[1], STDOUT_FILENO);
+		close(pipe_fd[1]);
+	}
+}
+
+void	close_pipe_parent(int pipe_fd[2], int *prev_pipe)
+{
+	if (*prev_pipe != -1)
+		close(*prev_pipe);
+	if (pipe_fd && pipe_fd[0] != -1)
+	{
+		close(pipe_fd[1]);
+		*prev_pipe = pipe_fd[0];
+	}
+}
@@ -0,0 +1,87 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:04:37 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 16:04:37 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static void	adopt_redirect_fd(int fd, int *slot)
+{
+	if (*slot != -1)
+		close(*slot);
+	fcntl(fd, F_SETFD, FD_CLOEXEC);
+	*slot = fd;
+}
+
+int	open_redirections(t_redir *redirs, int fds[2])
+{
+	int	fd;
+
+	fds[0] = -1;
+	fds[1] = -1;
+	while (redirs)
+	{
+		if (redirs->type == 3)
+			fd = dup(redirs->fd);
+		else
+			fd = open_file_for_redirect(redirs->file, redirs->type);
+		if (fd == -1)
+		{
+			close_fd_pair(fds);
+			return (-1);
+		}
+		if (redirs->type == 0 || redirs->type == 3)
+			adopt_redirect_fd(fd, &fds[0]);
+		else
+			adopt_redirect_fd(fd, &fds[1]);
+		redirs = redirs->next;
+	}
+	return (0);
+}
+
+static void	init_spawn_attr(posix_spawnattr_t *attr, int background)
+{
+	sigset_t	sigs;
+
+	posix_spawnattr_init(attr);
+	sigemptyset(&sigs);
+	posix_spawnattr_setsigmask(attr, &sigs);
+	if (!background)
+	{
+		sigaddset(&sigs, SIGINT);
+		sigaddset(&sigs, SIGQUIT);
+	}
+	posix_spawnattr_setsigdefault(attr, &sigs);
+	posix_spawnattr_setflags(attr, POSIX_SPAWN_SETSIGDEF
+		| POSIX_SPAWN_SETSIGMASK);
+}
+
+pid_t	spawn_command(char *cmd_path, char **args, t_shell *shell, int fds[2])
+{
+	posix_spawn_file_actions_t	actions;
+	posix_spawnattr_t			attr;
+	pid_t						pid;
+	int							err;
+
+	posix_spawn_file_actions_init(&actions);
+	if (fds[0] != -1)
+		posix_spawn_file_actions_adddup2(&actions, fds[0], STDIN_FILENO);
+	if (fds[1] != -1)
+		posix_spawn_file_actions_adddup2(&actions, fds[1], STDOUT_FILENO);
+	init_spawn_attr(&attr, shell->background);
+	err = posix_spawn(&pid, cmd_path, &actions, &attr, args,
+			env_to_envp(shell->env));
+	posix_spawn_file_actions_destroy(&actions);
+	posix_spawnattr_destroy(&attr);
+	if (err == 0)
+		return (pid);
+	print_error("execve", strerror(err));
+	return (-1);
+}
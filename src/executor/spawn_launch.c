@@ -0,0 +1,59 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   spawn_launch.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:21:05 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 16:21:05 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+void	close_fd_pair(int fds[2])
+{
+	if (fds[0] != -1)
+		close(fds[0]);
+	if (fds[1] != -1)
+		close(fds[1]);
+	fds[0] = -1;
+	fds[1] = -1;
+}
+
+pid_t	start_external(t_stage *stage, t_shell *shell, int std_fds[2])
+{
+	int	use[2];
+
+	if (stage->status != -1)
+		return (0);
+	use[0] = stage->fds[0];
+	if (use[0] == -1)
+		use[0] = std_fds[0];
+	use[1] = stage->fds[1];
+	if (use[1] == -1)
+		use[1] = std_fds[1];
+	stage->pid = spawn_command(stage->path, stage->args, shell, use);
+	close_fd_pair(stage->fds);
+	if (stage->pid != -1)
+		return (stage->pid);
+	stage->pid = 0;
+	stage->status = ERROR_PERMISSION;
+	return (0);
+}
+
+pid_t	spawn_simple_command(t_cmd *cmd, t_shell *shell, int *status)
+{
+	t_stage	stage;
+	int		std_fds[2];
+	pid_t	pid;
+
+	std_fds[0] = -1;
+	std_fds[1] = -1;
+	prepare_stages(cmd, shell, &stage);
+	pid = start_external(&stage, shell, std_fds);
+	release_stages(&stage, 1);
+	*status = stage.status;
+	return (pid);
+}
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stage.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:21:05 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 16:21:05 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static char	*memo_lookup(t_stage *stages, int index, char *name)
+{
+	int	i;
+
+	i = 0;
+	while (i < index)
+	{
+		if (stages[i].path && ft_strcmp(stages[i].args[0], name) == 0)
+			return (ft_strdup(stages[i].path));
+		i++;
+	}
+	return (NULL);
+}
+
+static int	resolve_stage(t_cmd *cmd, t_shell *shell, t_stage *stages,
+							int index)
+{
+	t_stage	*stage;
+
+	stage = &stages[index];
+	stage->args = expand_args_tildes(cmd->args, shell->env);
+	if (!stage->args)
+		return (1);
+	stage->path = memo_lookup(stages, index, stage->args[0]);
+	if (!stage->path)
+		stage->path = resolve_command(stage->args[0], shell);
+	if (stage->path)
+		return (-1);
+	print_error(stage->args[0], "command not found");
+	return (ERROR_CMD_NOT_FOUND);
+}
+
+static void	prepare_stage(t_cmd *cmd, t_shell *shell, t_stage *stages,
+							int index)
+{
+	t_stage	*stage;
+
+	stage = &stages[index];
+	if (open_redirections(cmd->redirs, stage->fds) == -1)
+		stage->status = 1;
+	else if (!cmd->args || !cmd->args[0])
+		stage->status = 0;
+	else
+		stage->status = resolve_stage(cmd, shell, stages, index);
+}
+
+void	prepare_stages(t_cmd *cmd_list, t_shell *shell, t_stage *stages)
+{
+	int	i;
+
+	i = 0;
+	while (cmd_list)
+	{
+		stages[i].fds[0] = -1;
+		stages[i].fds[1] = -1;
+		stages[i].path = NULL;
+		stages[i].args = NULL;
+		stages[i].status = -1;
+		stages[i].pid = 0;
+		if (!cmd_list->args || !is_builtin(cmd_list->args[0]))
+			prepare_stage(cmd_list, shell, stages, i);
+		cmd_list = cmd_list->next;
+		i++;
+	}
+}
+
+void	release_stages(t_stage *stages, int count)
+{
+	int	i;
+
+	i = 0;
+	while (i < count)
+	{
+		close_fd_pair(stages[i].fds);
+		free(stages[i].path);
+		free_string_array(stages[i].args);
+		i++;
+	}
+}
@@ -0,0 +1,73 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   stage_builtin.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:04:51 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 18:04:51 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+int	is_output_builtin(t_cmd *cmd)
+{
+	if (!cmd->args || !cmd->args[0])
+		return (0);
+	if (ft_strcmp(cmd->args[0], "echo") == 0)
+		return (1);
+	if (ft_strcmp(cmd->args[0], "env") == 0)
+		return (1);
+	if (ft_strcmp(cmd->args[0], "pwd") == 0)
+		return (1);
+	if (ft_strcmp(cmd->args[0], "export") == 0)
+		return (cmd->args[1] == NULL);
+	return (0);
+}
+
+static int	capture_stdout(int fd)
+{
+	int	saved_stdout;
+
+	saved_stdout = dup(STDOUT_FILENO);
+	if (saved_stdout != -1 && fd != -1)
+		dup2(fd, STDOUT_FILENO);
+	return (saved_stdout);
+}
+
+static void	restore_stdout(int saved_stdout)
+{
+	if (saved_stdout == -1)
+		return ;
+	dup2(saved_stdout, STDOUT_FILENO);
+	close(saved_stdout);
+}
+
+int	run_builtin_stage(t_cmd *cmd, t_shell *shell, t_exec *exec,
+		t_pipeline_data *data)
+{
+	t_stage	*stage;
+	int		output;
+	int		saved_stdout;
+
+	stage = &data->stages[data->index];
+	output = -1;
+	if (cmd->next)
+	{
+		output = open_memory_file();
+		if (output == -1)
+			return (-1);
+	}
+	saved_stdout = capture_stdout(output);
+	stage->status = execute_builtin_with_redirs(cmd, shell);
+	restore_stdout(saved_stdout);
+	stage->pid = 0;
+	if (exec->prev_pipe != -1)
+		close(exec->prev_pipe);
+	exec->prev_pipe = output;
+	if (output != -1)
+		lseek(output, 0, SEEK_SET);
+	return (0);
+}
@@ -0,0 +1,75 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   batch.c                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:16:54 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 17:16:54 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static int	open_batch_reader(t_reader *reader, int argc, char **argv)
+{
+	int	fd;
+
+	if (ft_strcmp(argv[1], "-c") == 0)
+	{
+		if (argc < 3)
+		{
+			print_error("-c", "option requires an argument");
+			return (ERROR_SYNTAX);
+		}
+		if (reader_init(reader, -1, argv[2]) == -1)
+			return (ERROR_MALLOC);
+		return (0);
+	}
+	fd = open(argv[1], O_RDONLY);
+	if (fd == -1)
+	{
+		print_error(argv[1], strerror(errno));
+		return (ERROR_CMD_NOT_FOUND);
+	}
+	if (reader_init(reader, fd, NULL) == -1)
+	{
+		close(fd);
+		return (ERROR_MALLOC);
+	}
+	return (0);
+}
+
+static void	process_batch_line(char *line, t_shell *shell, int first)
+{
+	if (first && line[0] == '#' && line[1] == '!')
+		return ;
+	if (!cy0_check_quote_1(line))
+		process_line(line, shell);
+}
+
+int	run_batch(t_shell *shell, int argc, char **argv)
+{
+	t_reader	reader;
+	char		*line;
+	int			first;
+	int			status;
+
+	status = open_batch_reader(&reader, argc, argv);
+	if (status)
+		return (status);
+	set_input_reader(&reader);
+	first = 1;
+	line = reader_next_line(&reader);
+	while (line)
+	{
+		process_batch_line(line, shell, first);
+		free(line);
+		first = 0;
+		line = reader_next_line(&reader);
+	}
+	set_input_reader(NULL);
+	reader_destroy(&reader);
+	return (shell->last_exit_status);
+}
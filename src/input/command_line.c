@@ -0,0 +1,56 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   command_line.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:05:52 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 14:05:52 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static int	parse_input_list(t_cmd_list **list, char *line, t_shell *shell)
+{
+	t_input		*head_input;
+	t_syntax	err;
+
+	head_input = cy1_make_list(line);
+	if (!head_input || (head_input->type == 1 && !head_input->next))
+		return (1);
+	if (cy3_substi_check(&head_input))
+	{
+		shell->last_exit_status = 1;
+		return (1);
+	}
+	*list = cy2_split_list(head_input, &err);
+	if (*list)
+		return (0);
+	shell->last_exit_status = 1;
+	if (!err.token)
+		return (1);
+	print_syntax_error(&err);
+	shell->last_exit_status = ERROR_SYNTAX;
+	return (1);
+}
+
+int	parse_command_line(char *line, t_shell *shell, t_cmd_list **list)
+{
+	t_parse_cache	*cache;
+
+	cache = &shell->parse_cache;
+	cache->nodes = NULL;
+	if (!parse_cache_replay(cache, line, shell, list))
+		return (0);
+	if (parse_input_list(list, line, shell))
+		return (1);
+	if ((*list)->next)
+		return (0);
+	parse_cache_snapshot(cache, (*list)->tokens);
+	if (prepare_pipeline(*list, shell))
+		return (1);
+	parse_cache_commit(cache, line, (*list)->cmds);
+	return (0);
+}
@@ -0,0 +1,93 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:02:11 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 14:02:11 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+void	history_reset(t_history *hist)
+{
+	hist->path = NULL;
+	hist->fd = -1;
+	hist->max = HISTORY_SIZE;
+	hist->lines = 0;
+	hist->index.lines = NULL;
+	hist->index.count = 0;
+	hist->index.cap = 0;
+	hist->index.base = 0;
+	hist->index.buckets = NULL;
+	hist->query = NULL;
+	hist->match = -1;
+}
+
+static char	*history_path(t_env *env)
+{
+	char	*path;
+
+	path = get_env_value(env, "HISTFILE");
+	if (path && *path)
+		return (ft_strdup(path));
+	path = get_env_value(env, "HOME");
+	if (!path || !*path)
+		return (NULL);
+	return (ft_strjoin(path, HISTORY_FILE));
+}
+
+void	history_init(t_history *hist, t_env *env)
+{
+	char	*size;
+
+	if (!isatty(STDIN_FILENO))
+		return ;
+	size = get_env_value(env, "HISTFILESIZE");
+	if (size && ft_atoi(size) > 0)
+		hist->max = ft_atoi(size);
+	stifle_history(hist->max);
+	history_bind(hist);
+	hist->path = history_path(env);
+	if (hist->path)
+		history_map(hist, 1);
+}
+
+void	history_add(t_history *hist, char *line)
+{
+	t_out	out;
+
+	if (hist->index.count > 0 && ft_strcmp(line,
+			hist->index.lines[hist->index.count - 1]) == 0)
+		return ;
+	add_history(line);
+	hist_index_add(&hist->index, line);
+	if (hist->index.count >= 2 * hist->max)
+		hist_index_trim(&hist->index, hist->max);
+	hist->match = -1;
+	if (hist->fd < 0)
+		return ;
+	out_init(&out, hist->fd);
+	out_str(&out, line);
+	out_put(&out, "\n", 1);
+	if (out_flush(&out) == 0)
+		hist->lines++;
+	if (hist->lines < 2 * hist->max)
+		return ;
+	close(hist->fd);
+	hist->fd = -1;
+	history_map(hist, 0);
+}
+
+void	history_close(t_history *hist)
+{
+	if (hist->fd >= 0)
+		close(hist->fd);
+	free(hist->path);
+	free(hist->query);
+	hist_index_clear(&hist->index);
+	history_reset(hist);
+}
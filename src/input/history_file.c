@@ -0,0 +1,109 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_file.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:02:11 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 14:02:11 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static size_t	history_tail(char *map, size_t *end, int max, int *count)
+{
+	size_t	p;
+
+	if (*end > 0 && map[*end - 1] == '\n')
+		*end = *end - 1;
+	p = *end;
+	*count = (*end > 0);
+	while (p > 0)
+	{
+		if (map[p - 1] == '\n')
+		{
+			if (*count == max)
+				break ;
+			*count = *count + 1;
+		}
+		p--;
+	}
+	return (p);
+}
+
+static void	history_rewrite(t_history *hist, char *tail, size_t len)
+{
+	t_out	out;
+	char	*tmp;
+	int		ok;
+
+	tmp = ft_strjoin(hist->path, ".tmp");
+	if (!tmp)
+		return ;
+	out_init(&out, open(tmp, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600));
+	if (out.fd >= 0)
+	{
+		out_put(&out, tail, len);
+		out_put(&out, "\n", 1);
+		ok = (out_flush(&out) == 0);
+		if (close(out.fd) == 0 && ok)
+			rename(tmp, hist->path);
+		else
+			unlink(tmp);
+	}
+	free(tmp);
+}
+
+static void	history_replay(t_history *hist, char *s, size_t len)
+{
+	char	*line;
+	size_t	i;
+	size_t	j;
+
+	i = 0;
+	while (i < len)
+	{
+		j = i;
+		while (j < len && s[j] != '\n')
+			j++;
+		line = malloc(j - i + 1);
+		if (!line)
+			return ;
+		ft_memcpy(line, s + i, j - i);
+		line[j - i] = '\0';
+		if (j > i)
+			history_add(hist, line);
+		free(line);
+		i = j + 1;
+	}
+}
+
+void	history_map(t_history *hist, int replay)
+{
+	struct stat	st;
+	char		*map;
+	size_t		start;
+	size_t		end;
+	int			fd;
+
+	fd = open(hist->path, O_RDONLY | O_CLOEXEC);
+	map = MAP_FAILED;
+	if (fd >= 0 && fstat(fd, &st) == 0 && st.st_size > 0)
+		map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (fd >= 0)
+		close(fd);
+	if (map != MAP_FAILED)
+	{
+		end = st.st_size;
+		start = history_tail(map, &end, hist->max, &hist->lines);
+		if (start > 0)
+			history_rewrite(hist, map + start, end - start);
+		if (replay)
+			history_replay(hist, map + start, end - start);
+		munmap(map, st.st_size);
+	}
+	hist->fd = open(hist->path, O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC,
+			0600);
+}
@@ -0,0 +1,124 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_index.c                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:41:27 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 14:41:27 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static int	index_line(t_hist_index *idx, int id)
+{
+	t_trigram	*node;
+	char		*s;
+	int			i;
+
+	s = idx->lines[id];
+	i = 0;
+	while (s[i] && s[i + 1] && s[i + 2])
+	{
+		node = hist_posting_get(idx, s + i);
+		if (!node || hist_posting_push(node, id))
+			return (1);
+		i++;
+	}
+	return (0);
+}
+
+static void	index_free_postings(t_hist_index *idx)
+{
+	t_trigram	*node;
+	int			i;
+
+	i = 0;
+	while (idx->buckets && i < HISTORY_INDEX_SIZE)
+	{
+		while (idx->buckets[i])
+		{
+			node = idx->buckets[i];
+			idx->buckets[i] = node->next;
+			free(node->ids);
+			free(node);
+		}
+		i++;
+	}
+}
+
+int	hist_index_add(t_hist_index *idx, char *line)
+{
+	char	**lines;
+
+	if (!idx->buckets)
+	{
+		idx->buckets = malloc(sizeof(t_trigram *) * HISTORY_INDEX_SIZE);
+		if (!idx->buckets)
+			return (1);
+		cy_memset(idx->buckets, 0, sizeof(t_trigram *) * HISTORY_INDEX_SIZE);
+	}
+	if (idx->count == idx->cap)
+	{
+		lines = malloc(sizeof(char *) * (idx->cap * 2 + 64));
+		if (!lines)
+			return (1);
+		ft_memcpy(lines, idx->lines, sizeof(char *) * idx->count);
+		free(idx->lines);
+		idx->lines = lines;
+		idx->cap = idx->cap * 2 + 64;
+	}
+	idx->lines[idx->count] = ft_strdup(line);
+	if (!idx->lines[idx->count])
+		return (1);
+	idx->count++;
+	return (index_line(idx, idx->count - 1));
+}
+
+void	hist_index_trim(t_hist_index *idx, int keep)
+{
+	int	drop;
+	int	i;
+
+	if (idx->count <= keep)
+		return ;
+	drop = idx->count - keep;
+	index_free_postings(idx);
+	i = 0;
+	while (i < drop)
+	{
+		free(idx->lines[i]);
+		i++;
+	}
+	ft_memmove(idx->lines, idx->lines + drop, sizeof(char *) * keep);
+	idx->count = keep;
+	idx->base += drop;
+	i = 0;
+	while (i < keep)
+	{
+		index_line(idx, i);
+		i++;
+	}
+}
+
+void	hist_index_clear(t_hist_index *idx)
+{
+	int	i;
+
+	index_free_postings(idx);
+	i = 0;
+	while (i < idx->count)
+	{
+		free(idx->lines[i]);
+		i++;
+	}
+	free(idx->lines);
+	free(idx->buckets);
+	idx->lines = NULL;
+	idx->buckets = NULL;
+	idx->count = 0;
+	idx->cap = 0;
+	idx->base = 0;
+}
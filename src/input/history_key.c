@@ -0,0 +1,55 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_key.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:41:27 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 14:41:27 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static t_history	**history_slot(void)
+{
+	static t_history	*hist = NULL;
+
+	return (&hist);
+}
+
+static int	history_key_search(int count, int key)
+{
+	t_history	*hist;
+	int			before;
+	int			id;
+
+	(void)count;
+	(void)key;
+	hist = *history_slot();
+	before = hist->index.count;
+	if (hist->match >= 0 && hist->query
+		&& ft_strcmp(rl_line_buffer, hist->index.lines[hist->match]) == 0)
+		before = hist->match;
+	else
+	{
+		free(hist->query);
+		hist->query = ft_strdup(rl_line_buffer);
+	}
+	id = -1;
+	if (hist->query)
+		id = hist_index_search(&hist->index, hist->query, before);
+	if (id < 0)
+		return (rl_ding());
+	hist->match = id;
+	rl_replace_line(hist->index.lines[id], 0);
+	rl_point = rl_end;
+	return (0);
+}
+
+void	history_bind(t_history *hist)
+{
+	*history_slot() = hist;
+	rl_bind_keyseq("\\C-r", history_key_search);
+}
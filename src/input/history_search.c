@@ -0,0 +1,76 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_search.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:41:27 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 14:41:27 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static int	index_shortest(t_hist_index *idx, char *query, t_trigram **best)
+{
+	t_trigram	*node;
+	int			i;
+
+	*best = NULL;
+	i = 0;
+	while (query[i] && query[i + 1] && query[i + 2])
+	{
+		node = hist_index_lookup(idx, query + i);
+		if (!node)
+			return (0);
+		if (!*best || node->count < (*best)->count)
+			*best = node;
+		i++;
+	}
+	return (1);
+}
+
+static int	posting_before(t_trigram *node, int before)
+{
+	int	lo;
+	int	hi;
+	int	mid;
+
+	lo = 0;
+	hi = node->count;
+	while (lo < hi)
+	{
+		mid = lo + (hi - lo) / 2;
+		if (node->ids[mid] < before)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return (lo - 1);
+}
+
+int	hist_index_search(t_hist_index *idx, char *query, int before)
+{
+	t_trigram	*best;
+	int			k;
+	int			id;
+
+	if (before > idx->count)
+		before = idx->count;
+	if (!index_shortest(idx, query, &best))
+		return (-1);
+	k = before - 1;
+	if (best)
+		k = posting_before(best, before);
+	while (k >= 0)
+	{
+		id = k;
+		if (best)
+			id = best->ids[k];
+		if (ft_strstr(idx->lines[id], query))
+			return (id);
+		k--;
+	}
+	return (-1);
+}
@@ -0,0 +1,79 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   history_trigram.c                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 14:41:27 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 14:41:27 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+unsigned int	hist_trigram(const char *s, unsigned int *slot)
+{
+	unsigned int	key;
+
+	key = ((unsigned int)(unsigned char)s[0] << 16)
+		| ((unsigned int)(unsigned char)s[1] << 8) | (unsigned char)s[2];
+	*slot = ((key * 2654435761u) >> 16) % HISTORY_INDEX_SIZE;
+	return (key);
+}
+
+t_trigram	*hist_index_lookup(t_hist_index *idx, const char *s)
+{
+	t_trigram		*node;
+	unsigned int	key;
+	unsigned int	slot;
+
+	if (!idx->buckets)
+		return (NULL);
+	key = hist_trigram(s, &slot);
+	node = idx->buckets[slot];
+	while (node && node->key != key)
+		node = node->next;
+	return (node);
+}
+
+t_trigram	*hist_posting_get(t_hist_index *idx, const char *s)
+{
+	t_trigram		*node;
+	unsigned int	slot;
+
+	node = hist_index_lookup(idx, s);
+	if (node)
+		return (node);
+	node = malloc(sizeof(t_trigram));
+	if (!node)
+		return (NULL);
+	node->key = hist_trigram(s, &slot);
+	node->ids = NULL;
+	node->count = 0;
+	node->cap = 0;
+	node->next = idx->buckets[slot];
+	idx->buckets[slot] = node;
+	return (node);
+}
+
+int	hist_posting_push(t_trigram *node, int id)
+{
+	int	*ids;
+
+	if (node->count > 0 && node->ids[node->count - 1] == id)
+		return (0);
+	if (node->count == node->cap)
+	{
+		ids = malloc(sizeof(int) * (node->cap * 2 + 4));
+		if (!ids)
+			return (1);
+		ft_memcpy(ids, node->ids, sizeof(int) * node->count);
+		free(node->ids);
+		node->ids = ids;
+		node->cap = node->cap * 2 + 4;
+	}
+	node->ids[node->count] = id;
+	node->count++;
+	return (0);
+}
@@ -1,95 +1,101 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   input_processing.c                                 :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:40:45 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:40:45 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../includes/minishell.h"
-
-int	parse_and_validate_input(t_input **head_input, char *line,
-		t_shell *shell)
-{
-	*head_input = cy1_make_list(line);
-	if (!*head_input)
-		return (1);
-	if ((*head_input)->type == 1 && !(*head_input)->next)
-	{
-		cy0_free_input_list(*head_input);
-		return (1);
-	}
-	if (cy3_substi_check(head_input, shell->env))
-	{
-		cy0_free_input_list(*head_input);
-		shell->last_exit_status = 1;
-		return (1);
-	}
-	if (cy3_scan_dollar_syntax(*head_input, shell->env,
-			shell->last_exit_status))
-	{
-		cy0_free_input_list(*head_input);
-		shell->last_exit_status = 1;
-		return (1);
-	}
-	return (0);
-}
-
-int	validate_and_convert_syntax(t_input *head_input, t_cmd **head_cmd,
-		t_shell *shell)
-{
-	cy1_remove_space_nodes(&head_input);
-	if (validate_syntax(head_input))
-	{
-		cy0_free_input_list(head_input);
-		shell->last_exit_status = ERROR_SYNTAX;
-		return (1);
-	}
-	*head_cmd = cy2_convert_cmd(head_input);
-	cy0_free_input_list(head_input);
-	if (!*head_cmd)
-	{
-		shell->last_exit_status = 1;
-		return (1);
-	}
-	return (0);
-}
-
-void	process_line(char *line, t_shell *shell)
-{
-	t_input	*head_input;
-	t_cmd	*head_cmd;
-
-	if (parse_and_validate_input(&head_input, line, shell))
-		return ;
-	if (validate_and_convert_syntax(head_input, &head_cmd, shell))
-		return ;
-	if (!check_last_cmd_args_null(head_cmd))
-		shell->last_exit_status = execute_command_line(head_cmd, shell);
-	cy0_free_cmd_list(head_cmd);
-	if (shell->should_exit)
-	{
-		cleanup_shell(shell);
-		exit(shell->last_exit_status);
-	}
-}
-
-void	process_input_line(char *line, t_shell *shell)
-{
-	if (is_not_only_whitespace(line) == 0)
-		add_history(line);
-	rl_event_hook = NULL;
-	g_signal_received = 0;
-	if (!cy0_check_quote_1(line))
-		process_line(line, shell);
-	rl_event_hook = check_signals_hook;
-	if (g_signal_received == SIGINT)
-	{
-		shell->last_exit_status = 130;
-		g_signal_received = 0;
-	}
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_processing.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:40:45 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:40:45 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../includes/minishell.h"
+
+int	prepare_pipeline(t_cmd_list *node, t_shell *shell)
+{
+	if (cy3_scan_dollar_syntax(node->tokens, shell->env,
+			shell->last_exit_status, shell->last_bg_pid))
+	{
+		shell->last_exit_status = 1;
+		return (1);
+	}
+	return (validate_and_convert_syntax(node->tokens, &node->cmds, shell));
+}
+
+int	validate_and_convert_syntax(t_input *head_input, t_cmd **head_cmd,
+		t_shell *shell)
+{
+	cy1_remove_space_nodes(&head_input);
+	if (validate_syntax(head_input))
+	{
+		shell->last_exit_status = ERROR_SYNTAX;
+		return (1);
+	}
+	*head_cmd = cy2_convert_cmd(head_input);
+	if (!*head_cmd)
+	{
+		shell->last_exit_status = 1;
+		return (1);
+	}
+	return (0);
+}
+
+static int	take_background(char *line, t_syntax *err)
+{
+	int	end;
+
+	end = ft_strlen(line);
+	while (end > 0 && g_cy0_class[(unsigned char)line[end - 1]] == -1)
+		end--;
+	if (end == 0 || line[end - 1] != '&')
+		return (0);
+	if (end > 1 && line[end - 2] == '&')
+		return (0);
+	line[end - 1] = '\0';
+	err->token = "&";
+	err->column = end;
+	if (is_not_only_whitespace(line))
+		return (-1);
+	return (1);
+}
+
+void	process_line(char *line, t_shell *shell)
+{
+	t_cmd_list	*list;
+	t_syntax	err;
+
+	jobs_reap(&shell->jobs);
+	jobs_prune(&shell->jobs);
+	shell->background = take_background(line, &err);
+	if (shell->background == -1)
+	{
+		print_syntax_error(&err);
+		shell->last_exit_status = ERROR_SYNTAX;
+	}
+	else if (!parse_command_line(line, shell, &list))
+		shell->last_exit_status = execute_list(list, shell);
+	shell->background = 0;
+	cy_arena_reset();
+	if (shell->should_exit)
+	{
+		cleanup_shell(shell);
+		exit(shell->last_exit_status);
+	}
+}
+
+void	process_input_line(char *line, t_shell *shell)
+{
+	if (is_not_only_whitespace(line) == 0)
+		history_add(&shell->history, line);
+	rl_event_hook = NULL;
+	g_signal_received = 0;
+	if (!cy0_check_quote_1(line))
+		process_line(line, shell);
+	rl_event_hook = check_signals_hook;
+	if (g_signal_received == SIGINT)
+	{
+		shell->last_exit_status = 130;
+		g_signal_received = 0;
+	}
+}
@@ -0,0 +1,40 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   input_source.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:10:31 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 17:10:31 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static t_reader	**input_reader_slot(void)
+{
+	static t_reader	*reader = NULL;
+
+	return (&reader);
+}
+
+void	set_input_reader(t_reader *reader)
+{
+	*input_reader_slot() = reader;
+}
+
+int	is_batch_input(void)
+{
+	return (*input_reader_slot() != NULL);
+}
+
+char	*read_input_line(char *prompt)
+{
+	t_reader	*reader;
+
+	reader = *input_reader_slot();
+	if (!reader)
+		return (readline(prompt));
+	return (reader_next_line(reader));
+}
@@ -0,0 +1,101 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_cache.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:12:41 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 10:12:41 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+void	*parse_cache_alloc(t_cache_entry *entry, size_t size)
+{
+	t_arena_block	*block;
+	void			*ptr;
+
+	size = (size + 15) & ~((size_t)15);
+	block = entry->mem;
+	if (!block || block->used + size > block->size)
+	{
+		block = malloc(sizeof(t_arena_block) + size + PARSE_CACHE_BLOCK);
+		if (!block)
+			return (NULL);
+		block->size = size + PARSE_CACHE_BLOCK;
+		block->used = 0;
+		block->next = entry->mem;
+		entry->mem = block;
+	}
+	ptr = (char *)(block + 1) + block->used;
+	block->used += size;
+	return (ptr);
+}
+
+static void	cache_unlink(t_parse_cache *cache, t_cache_entry *entry)
+{
+	if (entry->prev)
+		entry->prev->next = entry->next;
+	else
+		cache->head = entry->next;
+	if (entry->next)
+		entry->next->prev = entry->prev;
+	else
+		cache->tail = entry->prev;
+	entry->prev = NULL;
+	entry->next = NULL;
+}
+
+void	parse_cache_free(t_cache_entry *entry)
+{
+	t_arena_block	*block;
+
+	while (entry->mem)
+	{
+		block = entry->mem;
+		entry->mem = block->next;
+		free(block);
+	}
+	free(entry);
+}
+
+t_cache_entry	*parse_cache_find(t_parse_cache *cache, char *line)
+{
+	t_cache_entry	*entry;
+	unsigned int	hash;
+
+	hash = parse_cache_hash(line);
+	entry = cache->head;
+	while (entry && (entry->hash != hash || ft_strcmp(entry->line, line)))
+		entry = entry->next;
+	if (!entry || entry == cache->head)
+		return (entry);
+	cache_unlink(cache, entry);
+	entry->next = cache->head;
+	cache->head->prev = entry;
+	cache->head = entry;
+	return (entry);
+}
+
+void	parse_cache_insert(t_parse_cache *cache, t_cache_entry *entry)
+{
+	t_cache_entry	*oldest;
+
+	if (cache->count == PARSE_CACHE_SIZE)
+	{
+		oldest = cache->tail;
+		cache_unlink(cache, oldest);
+		parse_cache_free(oldest);
+		cache->count--;
+	}
+	entry->prev = NULL;
+	entry->next = cache->head;
+	if (cache->head)
+		cache->head->prev = entry;
+	else
+		cache->tail = entry;
+	cache->head = entry;
+	cache->count++;
+}
@@ -0,0 +1,100 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_cache_line.c                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:54:26 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 10:54:26 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+unsigned int	parse_cache_hash(char *line)
+{
+	unsigned int	h;
+
+	h = 5381;
+	while (*line)
+	{
+		h = h * 33 + (unsigned char)*line;
+		line++;
+	}
+	return (h);
+}
+
+int	parse_cache_plain(char *word)
+{
+	int	class;
+
+	while (*word)
+	{
+		class = g_cy0_class2[(unsigned char)*word];
+		if (class >= 1 || class == -14 || *word == '|'
+			|| *word == '<' || *word == '>')
+			return (0);
+		word++;
+	}
+	return (1);
+}
+
+void	parse_cache_snapshot(t_parse_cache *cache, t_input *head)
+{
+	t_input	*node;
+	int		i;
+
+	cache->nnodes = 0;
+	node = head;
+	while (node)
+	{
+		cache->nnodes++;
+		node = node->next;
+	}
+	cache->nodes = cy_arena_alloc(sizeof(t_input *) * cache->nnodes);
+	cache->raw = cy_arena_alloc(sizeof(t_cache_word) * cache->nnodes);
+	i = 0;
+	node = head;
+	while (node && cache->nodes && cache->raw)
+	{
+		cache->nodes[i] = node;
+		cache->raw[i].input = node->input;
+		cache->raw[i].spans = node->spans;
+		cache->raw[i].nspans = node->nspans;
+		node = node->next;
+		i++;
+	}
+	if (!cache->raw)
+		cache->nodes = NULL;
+}
+
+void	parse_cache_clear(t_parse_cache *cache)
+{
+	t_cache_entry	*entry;
+
+	while (cache->head)
+	{
+		entry = cache->head;
+		cache->head = entry->next;
+		parse_cache_free(entry);
+	}
+	cache->tail = NULL;
+	cache->count = 0;
+	cache->nodes = NULL;
+}
+
+void	parse_cache_commit(t_parse_cache *cache, char *line, t_cmd *cmds)
+{
+	int	i;
+
+	i = 0;
+	while (cache->nodes && i < cache->nnodes)
+	{
+		if (cache->nodes[i]->input != cache->raw[i].input
+			&& !parse_cache_plain(cache->nodes[i]->input))
+			cache->nodes = NULL;
+		i++;
+	}
+	parse_cache_record(cache, line, cmds);
+}
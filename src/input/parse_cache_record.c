@@ -0,0 +1,132 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_cache_record.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 10:31:07 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 10:31:07 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static char	*cache_strdup(t_cache_entry *entry, char *s)
+{
+	char	*copy;
+	size_t	len;
+
+	if (!s)
+		return (NULL);
+	len = ft_strlen(s);
+	copy = parse_cache_alloc(entry, len + 1);
+	if (copy)
+		ft_memcpy(copy, s, len + 1);
+	return (copy);
+}
+
+static int	record_word(t_parse_cache *cache, t_cache_entry *entry,
+		char *text, t_cache_word *word)
+{
+	int	i;
+
+	i = 0;
+	while (i < cache->nnodes && cache->nodes[i]->input != text)
+		i++;
+	if (i == cache->nnodes)
+		return (1);
+	word->spans = NULL;
+	word->nspans = cache->raw[i].nspans;
+	if (cache->raw[i].input == text)
+		word->input = cache_strdup(entry, text);
+	else
+	{
+		word->input = cache_strdup(entry, cache->raw[i].input);
+		word->spans = parse_cache_alloc(entry,
+				sizeof(t_span) * word->nspans);
+		if (!word->spans)
+			return (1);
+		ft_memcpy(word->spans, cache->raw[i].spans,
+			sizeof(t_span) * word->nspans);
+	}
+	return (word->input == NULL);
+}
+
+static int	record_words(t_parse_cache *cache, t_cache_entry *entry,
+		t_cmd *cmd, t_cache_cmd *tc)
+{
+	t_redir	*redir;
+	int		i;
+
+	i = -1;
+	while (++i < tc->argc)
+		if (record_word(cache, entry, cmd->args[i], &tc->words[i]))
+			return (1);
+	redir = cmd->redirs;
+	while (redir)
+	{
+		if (record_word(cache, entry, redir->file, &tc->words[i]))
+			return (1);
+		tc->words[i].redir = redir->type;
+		redir = redir->next;
+		i++;
+	}
+	return (0);
+}
+
+static t_cache_cmd	*record_cmd(t_parse_cache *cache, t_cache_entry *entry,
+		t_cmd *cmd)
+{
+	t_cache_cmd	*tc;
+	t_redir		*redir;
+
+	tc = parse_cache_alloc(entry, sizeof(t_cache_cmd));
+	if (!tc)
+		return (NULL);
+	tc->argc = count_string_array(cmd->args);
+	tc->nredir = 0;
+	redir = cmd->redirs;
+	while (redir)
+	{
+		tc->nredir++;
+		redir = redir->next;
+	}
+	tc->words = parse_cache_alloc(entry, sizeof(t_cache_word)
+			* (tc->argc + tc->nredir + 1));
+	tc->next = NULL;
+	if (!tc->words || record_words(cache, entry, cmd, tc))
+		return (NULL);
+	if (!cmd->args)
+		tc->argc = -1;
+	return (tc);
+}
+
+void	parse_cache_record(t_parse_cache *cache, char *line, t_cmd *cmds)
+{
+	t_cache_entry	*entry;
+	t_cache_cmd		**link;
+
+	if (!cache->nodes || parse_cache_find(cache, line))
+		return ;
+	entry = malloc(sizeof(t_cache_entry));
+	if (!entry)
+		return ;
+	entry->mem = NULL;
+	entry->cmds = NULL;
+	entry->hash = parse_cache_hash(line);
+	entry->line = cache_strdup(entry, line);
+	link = &entry->cmds;
+	while (entry->line && cmds)
+	{
+		*link = record_cmd(cache, entry, cmds);
+		if (!*link)
+			break ;
+		link = &(*link)->next;
+		cmds = cmds->next;
+	}
+	if (!entry->line || cmds)
+		parse_cache_free(entry);
+	else
+		parse_cache_insert(cache, entry);
+}
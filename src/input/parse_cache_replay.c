@@ -0,0 +1,131 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   parse_cache_replay.c                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 11:20:03 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 11:20:03 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static char	*replay_word(t_cache_word *word, t_shell *shell)
+{
+	t_input	node;
+	char	*copy;
+	int		len;
+
+	cy_memset(&node, 0, sizeof(t_input));
+	node.input = word->input;
+	node.spans = word->spans;
+	node.nspans = word->nspans;
+	if (word->spans && (cy3_scan_dollar_syntax(&node, shell->env,
+				shell->last_exit_status, shell->last_bg_pid)
+			|| !parse_cache_plain(node.input)))
+		return (NULL);
+	if (node.input != word->input)
+		return (node.input);
+	len = ft_strlen(word->input);
+	copy = cy_arena_alloc(len + 1);
+	if (copy)
+		ft_memcpy(copy, word->input, len + 1);
+	return (copy);
+}
+
+static int	replay_redirs(t_cache_cmd *tc, t_cmd *cmd, t_shell *shell)
+{
+	t_redir	**link;
+	int		first;
+	int		i;
+
+	first = tc->argc;
+	if (first < 0)
+		first = 0;
+	link = &cmd->redirs;
+	i = 0;
+	while (i < tc->nredir)
+	{
+		*link = cy_arena_alloc(sizeof(t_redir));
+		if (!*link)
+			return (1);
+		(*link)->type = tc->words[first + i].redir;
+		(*link)->file = replay_word(&tc->words[first + i], shell);
+		(*link)->fd = -1;
+		(*link)->next = NULL;
+		if (!(*link)->file)
+			return (1);
+		link = &(*link)->next;
+		i++;
+	}
+	return (0);
+}
+
+static int	replay_args(t_cache_cmd *tc, t_cmd *cmd, t_shell *shell)
+{
+	int	i;
+
+	if (tc->argc < 0)
+		return (0);
+	cmd->args = cy_arena_alloc(sizeof(char *) * (tc->argc + 1));
+	if (!cmd->args)
+		return (1);
+	i = 0;
+	while (i < tc->argc)
+	{
+		cmd->args[i] = replay_word(&tc->words[i], shell);
+		if (!cmd->args[i])
+			return (1);
+		i++;
+	}
+	cmd->args[i] = NULL;
+	return (0);
+}
+
+static t_cmd	*replay_cmd(t_cache_cmd *tc, t_shell *shell)
+{
+	t_cmd	*cmd;
+
+	cmd = cy_arena_alloc(sizeof(t_cmd));
+	if (!cmd)
+		return (NULL);
+	cmd->args = NULL;
+	cmd->redirs = NULL;
+	cmd->builtin_id = -1;
+	cmd->next = NULL;
+	if (replay_args(tc, cmd, shell) || replay_redirs(tc, cmd, shell))
+		return (NULL);
+	return (cmd);
+}
+
+int	parse_cache_replay(t_parse_cache *cache, char *line, t_shell *shell,
+		t_cmd_list **list)
+{
+	t_cache_entry	*entry;
+	t_cache_cmd		*tc;
+	t_cmd			head;
+	t_cmd			*last;
+
+	entry = parse_cache_find(cache, line);
+	*list = NULL;
+	if (entry)
+		*list = cy2_list_node(NULL);
+	if (!*list)
+		return (1);
+	head.next = NULL;
+	last = &head;
+	tc = entry->cmds;
+	while (tc)
+	{
+		last->next = replay_cmd(tc, shell);
+		if (!last->next)
+			return (1);
+		last = last->next;
+		cy2_fill_builtin_id(last);
+		tc = tc->next;
+	}
+	(*list)->cmds = head.next;
+	return (0);
+}
@@ -0,0 +1,114 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   reader.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:02:48 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 17:02:48 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+int	reader_init(t_reader *reader, int fd, char *text)
+{
+	reader->fd = fd;
+	reader->pos = 0;
+	reader->scan = 0;
+	reader->eof = (fd < 0);
+	if (text)
+		reader->buf = ft_strdup(text);
+	else
+		reader->buf = malloc(READER_BUFFER_SIZE);
+	if (!reader->buf)
+		return (-1);
+	reader->len = 0;
+	reader->cap = READER_BUFFER_SIZE;
+	if (text)
+		reader->len = ft_strlen(text);
+	if (text)
+		reader->cap = reader->len + 1;
+	return (0);
+}
+
+static int	reader_make_room(t_reader *reader)
+{
+	char	*grown;
+
+	if (reader->pos > 0)
+	{
+		ft_memmove(reader->buf, reader->buf + reader->pos,
+			reader->len - reader->pos);
+		reader->len -= reader->pos;
+		reader->scan -= reader->pos;
+		reader->pos = 0;
+	}
+	if (reader->len < reader->cap)
+		return (0);
+	grown = malloc(reader->cap * 2);
+	if (!grown)
+		return (-1);
+	ft_memcpy(grown, reader->buf, reader->len);
+	free(reader->buf);
+	reader->buf = grown;
+	reader->cap *= 2;
+	return (0);
+}
+
+static void	reader_fill(t_reader *reader)
+{
+	ssize_t	got;
+
+	if (reader_make_room(reader) == -1)
+	{
+		reader->eof = 1;
+		return ;
+	}
+	got = read(reader->fd, reader->buf + reader->len,
+			reader->cap - reader->len);
+	if (got == -1 && errno == EINTR)
+		return ;
+	if (got <= 0)
+		reader->eof = 1;
+	else
+		reader->len += got;
+}
+
+char	*reader_next_line(t_reader *reader)
+{
+	char	*line;
+	size_t	end;
+
+	while (1)
+	{
+		while (reader->scan < reader->len && reader->buf[reader->scan] != '\n')
+			reader->scan++;
+		if (reader->scan < reader->len || reader->eof)
+			break ;
+		reader_fill(reader);
+	}
+	end = reader->scan;
+	if (end == reader->pos && end == reader->len)
+		return (NULL);
+	line = malloc(end - reader->pos + 1);
+	if (!line)
+		return (NULL);
+	ft_memcpy(line, reader->buf + reader->pos, end - reader->pos);
+	line[end - reader->pos] = '\0';
+	if (end < reader->len)
+		end++;
+	reader->pos = end;
+	reader->scan = end;
+	return (line);
+}
+
+void	reader_destroy(t_reader *reader)
+{
+	free(reader->buf);
+	reader->buf = NULL;
+	if (reader->fd > STDERR_FILENO)
+		close(reader->fd);
+	reader->fd = -1;
+}
@@ -0,0 +1,88 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_control.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 17:02:26 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 17:02:26 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static void	announce_job(t_job *job, pid_t pid)
+{
+	char	*id;
+	char	*pid_str;
+
+	id = ft_itoa(job->id);
+	pid_str = ft_itoa(pid);
+	if (id && pid_str)
+	{
+		write(STDERR_FILENO, "[", 1);
+		write(STDERR_FILENO, id, ft_strlen(id));
+		write(STDERR_FILENO, "] ", 2);
+		write(STDERR_FILENO, pid_str, ft_strlen(pid_str));
+		write(STDERR_FILENO, "\n", 1);
+	}
+	free(id);
+	free(pid_str);
+}
+
+int	job_settle(t_shell *shell, t_job *job, int last)
+{
+	int	status;
+
+	if (shell->background && job->live > 0)
+	{
+		while (job->procs[last].pid == 0)
+			last--;
+		job->background = 1;
+		shell->last_bg_pid = job->procs[last].pid;
+		if (!is_batch_input())
+			announce_job(job, shell->last_bg_pid);
+		return (0);
+	}
+	job_wait(&shell->jobs, job, -1);
+	status = job_exit_code(job, last);
+	job_finish(&shell->jobs, job);
+	return (status);
+}
+
+t_job	*job_find(t_job_table *table, int value, int job_spec, int *index)
+{
+	t_job	*job;
+
+	job = table->head;
+	while (job)
+	{
+		*index = job->count - 1;
+		while (*index >= 0)
+		{
+			if (job_spec && job->id == value && job->procs[*index].pid > 0)
+				return (job);
+			if (!job_spec && value > 0 && job->procs[*index].pid == value)
+				return (job);
+			(*index)--;
+		}
+		job = job->next;
+	}
+	return (NULL);
+}
+
+int	job_claim(t_job_table *table, t_job *job, int index)
+{
+	int	status;
+	int	i;
+
+	status = job_exit_code(job, index);
+	job->procs[index].pid = 0;
+	i = 0;
+	while (i < job->count && job->procs[i].pid <= 0)
+		i++;
+	if (i == job->count)
+		job_finish(table, job);
+	return (status);
+}
@@ -0,0 +1,85 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_done.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:12:40 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 16:12:40 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+
+#include "../../includes/minishell.h"
+
+static void	job_remember(t_job_table *table, pid_t pid, int id, int status)
+{
+	int	i;
+
+	i = 0;
+	while (id > 0 && i < JOB_DONE_SIZE)
+	{
+		if (table->done_job[i] == id)
+			table->done_job[i] = 0;
+		i++;
+	}
+	table->done_pid[table->done_next] = pid;
+	table->done_job[table->done_next] = id;
+	table->done_status[table->done_next] = status;
+	table->done_next = (table->done_next + 1) % JOB_DONE_SIZE;
+}
+
+static void	job_forget(t_job_table *table, t_job *job)
+{
+	int	id;
+	int	i;
+
+	i = 0;
+	while (i < job->count)
+	{
+		id = 0;
+		if (i == job->count - 1)
+			id = job->id;
+		if (job->procs[i].pid > 0)
+			job_remember(table, job->procs[i].pid, id,
+				job_exit_code(job, i));
+		i++;
+	}
+	job_finish(table, job);
+}
+
+void	jobs_prune(t_job_table *table)
+{
+	t_job	*job;
+	t_job	*next;
+
+	job = table->head;
+	while (job)
+	{
+		next = job->next;
+		if (job->background && job->live == 0)
+			job_forget(table, job);
+		job = next;
+	}
+}
+
+int	job_done_status(t_job_table *table, int value, int job_spec, int *status)
+{
+	int	i;
+
+	i = 0;
+	while (value > 0 && i < JOB_DONE_SIZE)
+	{
+		if ((job_spec && table->done_job[i] == value)
+			|| (!job_spec && table->done_pid[i] == value))
+		{
+			*status = table->done_status[i];
+			table->done_pid[i] = 0;
+			table->done_job[i] = 0;
+			return (1);
+		}
+		i++;
+	}
+	return (0);
+}
@@ -0,0 +1,106 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_reap.c                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:21:09 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 16:21:09 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static void	job_record(t_job_table *table, pid_t pid, int status,
+		struct rusage *usage)
+{
+	t_job	*job;
+	int		i;
+
+	job = table->head;
+	while (job)
+	{
+		i = 0;
+		while (i < job->count)
+		{
+			if (job->procs[i].pid == pid && !job->procs[i].done)
+			{
+				job->procs[i].status = status;
+				job->procs[i].usage = *usage;
+				job->procs[i].done = 1;
+				job->live--;
+				return ;
+			}
+			i++;
+		}
+		job = job->next;
+	}
+}
+
+int	jobs_reap(t_job_table *table)
+{
+	struct rusage	usage;
+	pid_t			pid;
+	int				status;
+	int				reaped;
+
+	reaped = 0;
+	pid = wait4(-1, &status, WNOHANG, &usage);
+	while (pid > 0)
+	{
+		job_record(table, pid, status, &usage);
+		reaped++;
+		pid = wait4(-1, &status, WNOHANG, &usage);
+	}
+	if (pid == -1 && errno == ECHILD)
+		return (-1);
+	return (reaped);
+}
+
+static int	wait_sigchld(t_job_table *table)
+{
+	struct signalfd_siginfo	info;
+	struct rusage			usage;
+	pid_t					pid;
+	int						status;
+
+	if (table->sigfd != -1)
+	{
+		if (read(table->sigfd, &info, sizeof(info)) == -1 && errno != EINTR)
+			return (-1);
+		return (0);
+	}
+	pid = wait4(-1, &status, 0, &usage);
+	if (pid > 0)
+		job_record(table, pid, status, &usage);
+	if (pid == -1 && errno != EINTR)
+		return (-1);
+	return (0);
+}
+
+int	job_wait(t_job_table *table, t_job *job, int index)
+{
+	int	reaped;
+
+	reaped = jobs_reap(table);
+	while (job->live > 0 && (index < 0 || !job->procs[index].done))
+	{
+		if (job->background && g_signal_received == SIGINT)
+			return (-1);
+		if (reaped == -1 || wait_sigchld(table) == -1)
+			return (-1);
+		reaped = jobs_reap(table);
+	}
+	return (0);
+}
+
+int	job_exit_code(t_job *job, int index)
+{
+	int	status;
+
+	status = job->procs[index].status;
+	if (WIFSIGNALED(status))
+		return (128 + WTERMSIG(status));
+	return (WEXITSTATUS(status));
+}
@@ -0,0 +1,92 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   job_table.c                                        :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 16:05:42 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 16:05:42 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+void	jobs_init(t_job_table *table)
+{
+	sigset_t	mask;
+
+	table->head = NULL;
+	table->next_id = 1;
+	cy_memset(table->done_pid, 0, sizeof(table->done_pid));
+	cy_memset(table->done_job, 0, sizeof(table->done_job));
+	table->done_next = 0;
+	sigemptyset(&mask);
+	sigaddset(&mask, SIGCHLD);
+	sigprocmask(SIG_BLOCK, &mask, NULL);
+	table->sigfd = signalfd(-1, &mask, SFD_CLOEXEC);
+}
+
+void	jobs_destroy(t_job_table *table)
+{
+	t_job	*next;
+
+	while (table->head)
+	{
+		next = table->head->next;
+		free(table->head->procs);
+		free(table->head);
+		table->head = next;
+	}
+	if (table->sigfd != -1)
+		close(table->sigfd);
+	table->sigfd = -1;
+}
+
+t_job	*job_start(t_job_table *table, int count)
+{
+	t_job	*job;
+	t_job	**slot;
+
+	job = malloc(sizeof(t_job));
+	if (!job)
+		return (NULL);
+	cy_memset(job, 0, sizeof(t_job));
+	job->procs = malloc(sizeof(t_job_proc) * count);
+	if (!job->procs)
+	{
+		free(job);
+		return (NULL);
+	}
+	cy_memset(job->procs, 0, sizeof(t_job_proc) * count);
+	if (!table->head)
+		table->next_id = 1;
+	job->id = table->next_id;
+	table->next_id++;
+	job->count = count;
+	slot = &table->head;
+	while (*slot)
+		slot = &(*slot)->next;
+	*slot = job;
+	return (job);
+}
+
+void	job_track(t_job *job, int index, pid_t pid)
+{
+	job->procs[index].pid = pid;
+	job->procs[index].done = 0;
+	job->live++;
+}
+
+void	job_finish(t_job_table *table, t_job *job)
+{
+	t_job	**slot;
+
+	slot = &table->head;
+	while (*slot && *slot != job)
+		slot = &(*slot)->next;
+	if (*slot)
+		*slot = job->next;
+	free(job->procs);
+	free(job);
+}
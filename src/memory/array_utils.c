@@ -1,67 +1,67 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   array_utils.c                                      :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:41:01 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:41:01 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../includes/minishell.h"
-
-void	free_string_array(char **array)
-{
-	int	i;
-
-	if (!array)
-		return ;
-	i = 0;
-	while (array[i])
-	{
-		free(array[i]);
-		i++;
-	}
-	free(array);
-}
-
-int	count_string_array(char **array)
-{
-	int	count;
-
-	count = 0;
-	if (!array)
-		return (0);
-	while (array[count])
-		count++;
-	return (count);
-}
-
-char	**duplicate_string_array(char **array)
-{
-	char	**dup;
-	int		count;
-	int		i;
-
-	if (!array)
-		return (NULL);
-	count = count_string_array(array);
-	dup = malloc(sizeof(char *) * (count + 1));
-	if (!dup)
-		return (NULL);
-	i = 0;
-	while (i < count)
-	{
-		dup[i] = ft_strdup(array[i]);
-		if (!dup[i])
-		{
-			free_string_array(dup);
-			return (NULL);
-		}
-		i++;
-	}
-	dup[i] = NULL;
-	return (dup);
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   array_utils.c                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:41:01 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:41:01 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+void	free_string_array(char **array)
+{
+	int	i;
+
+	if (!array)
+		return ;
+	i = 0;
+	while (array[i])
+	{
+		free(array[i]);
+		i++;
+	}
+	free(array);
+}
+
+int	count_string_array(char **array)
+{
+	int	count;
+
+	count = 0;
+	if (!array)
+		return (0);
+	while (array[count])
+		count++;
+	return (count);
+}
+
+char	**duplicate_string_array(char **array)
+{
+	char	**dup;
+	int		count;
+	int		i;
+
+	if (!array)
+		return (NULL);
+	count = count_string_array(array);
+	dup = malloc(sizeof(char *) * (count + 1));
+	if (!dup)
+		return (NULL);
+	i = 0;
+	while (i < count)
+	{
+		dup[i] = ft_strdup(array[i]);
+		if (!dup[i])
+		{
+			free_string_array(dup);
+			return (NULL);
+		}
+		i++;
+	}
+	dup[i] = NULL;
+	return (dup);
+}
@@ -1,30 +1,80 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   cleanup.c                                          :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:41:07 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:41:07 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../includes/minishell.h"
-
-void	error_exit(char *msg, int exit_code)
-{
-	write(STDERR_FILENO, "minishell: ", 11);
-	write(STDERR_FILENO, msg, ft_strlen(msg));
-	write(STDERR_FILENO, "\n", 1);
-	exit(exit_code);
-}
-
-void	print_error(char *cmd, char *msg)
-{
-	write(STDERR_FILENO, "minishell: ", 11);
-	write(STDERR_FILENO, cmd, ft_strlen(cmd));
-	write(STDERR_FILENO, ": ", 2);
-	write(STDERR_FILENO, msg, ft_strlen(msg));
-	write(STDERR_FILENO, "\n", 1);
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   cleanup.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:41:07 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:41:07 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+void	init_shell(t_shell *shell, char **envp)
+{
+	shell->env = env_create(envp);
+	if (!shell->env)
+	{
+		write(STDERR_FILENO, "minishell: failed to copy environment\n", 38);
+		exit(1);
+	}
+	shell->last_exit_status = 0;
+	shell->in_pipe = 0;
+	shell->in_child = 0;
+	shell->current_child_pid = 0;
+	shell->should_exit = 0;
+	shell->background = 0;
+	shell->last_bg_pid = 0;
+	hash_init(&shell->cmd_hash);
+	jobs_init(&shell->jobs);
+	shell->parse_cache.head = NULL;
+	shell->parse_cache.tail = NULL;
+	shell->parse_cache.count = 0;
+	shell->parse_cache.nodes = NULL;
+	history_reset(&shell->history);
+}
+
+void	cleanup_shell(t_shell *shell)
+{
+	if (shell->env)
+		env_destroy(shell->env);
+	hash_clear(&shell->cmd_hash);
+	jobs_destroy(&shell->jobs);
+	parse_cache_clear(&shell->parse_cache);
+	history_close(&shell->history);
+	cy_arena_release();
+}
+
+void	error_exit(char *msg, int exit_code)
+{
+	write(STDERR_FILENO, "minishell: ", 11);
+	write(STDERR_FILENO, msg, ft_strlen(msg));
+	write(STDERR_FILENO, "\n", 1);
+	exit(exit_code);
+}
+
+void	print_error(char *cmd, char *msg)
+{
+	t_out	out;
+
+	out_init(&out, STDERR_FILENO);
+	out_put(&out, "minishell: ", 11);
+	out_str(&out, cmd);
+	out_put(&out, ": ", 2);
+	out_str(&out, msg);
+	out_put(&out, "\n", 1);
+	out_flush(&out);
+}
+
+void	print_error3(char *head, char *arg, char *tail)
+{
+	t_out	out;
+
+	out_init(&out, STDERR_FILENO);
+	out_str(&out, head);
+	out_str(&out, arg);
+	out_str(&out, tail);
+	out_flush(&out);
+}
@@ -0,0 +1,52 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   output.c                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:40:12 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 18:40:12 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+void	out_init(t_out *out, int fd)
+{
+	out->fd = fd;
+	out->count = 0;
+	out->used = 0;
+}
+
+void	out_put(t_out *out, char *s, size_t len)
+{
+	if (len == 0)
+		return ;
+	if (out->count == OUT_IOV_MAX)
+		out_flush(out);
+	out->iov[out->count].iov_base = s;
+	out->iov[out->count].iov_len = len;
+	out->count++;
+}
+
+void	out_str(t_out *out, char *s)
+{
+	if (s)
+		out_put(out, s, ft_strlen(s));
+}
+
+void	out_copy(t_out *out, char *s, size_t len)
+{
+	if (len > OUT_BUFFER_SIZE)
+	{
+		out_put(out, s, len);
+		out_flush(out);
+		return ;
+	}
+	if (out->count == OUT_IOV_MAX || out->used + len > OUT_BUFFER_SIZE)
+		out_flush(out);
+	ft_memcpy(out->buf + out->used, s, len);
+	out_put(out, out->buf + out->used, len);
+	out->used += len;
+}
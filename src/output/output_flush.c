@@ -0,0 +1,53 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   output_flush.c                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/18 18:46:30 by rlaigle           #+#    #+#             */
+/*   Updated: 2026/10/18 18:46:30 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+static void	out_advance(t_out *out, size_t written, int *first)
+{
+	struct iovec	*iov;
+
+	while (*first < out->count && written >= out->iov[*first].iov_len)
+	{
+		written -= out->iov[*first].iov_len;
+		(*first)++;
+	}
+	if (*first == out->count)
+		return ;
+	iov = &out->iov[*first];
+	iov->iov_base = (char *)iov->iov_base + written;
+	iov->iov_len -= written;
+}
+
+int	out_flush(t_out *out)
+{
+	ssize_t	written;
+	int		first;
+	int		result;
+
+	first = 0;
+	result = 0;
+	while (first < out->count)
+	{
+		written = writev(out->fd, out->iov + first, out->count - first);
+		if (written == -1 && errno != EINTR)
+		{
+			result = -1;
+			break ;
+		}
+		if (written > 0)
+			out_advance(out, written, &first);
+	}
+	out->count = 0;
+	out->used = 0;
+	return (result);
+}
@@ -1,29 +1,29 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   signal_heredoc.c                                   :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:41:17 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:41:17 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../includes/minishell.h"
-
-void	handle_sigint_heredoc(int sig)
-{
-	g_signal_received = sig;
-	close(STDIN_FILENO);
-}
-
-void	setup_heredoc_signals(void)
-{
-	struct sigaction	sa;
-
-	sigemptyset(&sa.sa_mask);
-	sa.sa_handler = handle_sigint_heredoc;
-	sa.sa_flags = 0;
-	sigaction(SIGINT, &sa, NULL);
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   signal_heredoc.c                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:41:17 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:41:17 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+void	handle_sigint_heredoc(int sig)
+{
+	g_signal_received = sig;
+	close(STDIN_FILENO);
+}
+
+void	setup_heredoc_signals(void)
+{
+	struct sigaction	sa;
+
+	sigemptyset(&sa.sa_mask);
+	sa.sa_handler = handle_sigint_heredoc;
+	sa.sa_flags = 0;
+	sigaction(SIGINT, &sa, NULL);
+}
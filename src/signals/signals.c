@@ -1,63 +1,63 @@
-/* ************************************************************************** */
-/*                                                                            */
-/*                                                        :::      ::::::::   */
-/*   signals.c                                          :+:      :+:    :+:   */
-/*                                                    +:+ +:+         +:+     */
-/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
-/*                                                +#+#+#+#+#+   +#+           */
-/*   Created: 2025/06/01 22:41:27 by rlaigle           #+#    #+#             */
-/*   Updated: 2025/06/01 22:41:27 by rlaigle          ###   ########.fr       */
-/*                                                                            */
-/* ************************************************************************** */
-
-#include "../../includes/minishell.h"
-
-int	check_signals_hook(void)
-{
-	if (g_signal_received == SIGINT)
-	{
-		rl_on_new_line();
-		rl_replace_line("", 0);
-		rl_done = 1;
-	}
-	return (0);
-}
-
-void	handle_sigint(int sig)
-{
-	g_signal_received = sig;
-	write(STDOUT_FILENO, "\n", 1);
-}
-
-void	handle_sigquit(int sig)
-{
-	(void)sig;
-}
-
-void	setup_signals(void)
-{
-	struct sigaction	sa_int;
-	struct sigaction	sa_quit;
-
-	g_signal_received = 0;
-	rl_event_hook = check_signals_hook;
-	sigemptyset(&sa_int.sa_mask);
-	sa_int.sa_handler = handle_sigint;
-	sa_int.sa_flags = 0;
-	sigaction(SIGINT, &sa_int, NULL);
-	sigemptyset(&sa_quit.sa_mask);
-	sa_quit.sa_handler = SIG_IGN;
-	sa_quit.sa_flags = 0;
-	sigaction(SIGQUIT, &sa_quit, NULL);
-}
-
-void	setup_child_signals(void)
-{
-	struct sigaction	sa;
-
-	sigemptyset(&sa.sa_mask);
-	sa.sa_handler = SIG_DFL;
-	sa.sa_flags = 0;
-	sigaction(SIGINT, &sa, NULL);
-	sigaction(SIGQUIT, &sa, NULL);
-}
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   signals.c                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: rlaigle <rlaigle@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2025/06/01 22:41:27 by rlaigle           #+#    #+#             */
+/*   Updated: 2025/06/01 22:41:27 by rlaigle          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#include "../../includes/minishell.h"
+
+int	check_signals_hook(void)
+{
+	if (g_signal_received == SIGINT)
+	{
+		rl_on_new_line();
+		rl_replace_line("", 0);
+		rl_done = 1;
+	}
+	return (0);
+}
+
+void	handle_sigint(int sig)
+{
+	g_signal_received = sig;
+	write(STDOUT_FILENO, "\n", 1);
+}
+
+void	handle_sigquit(int sig)
+{
+	(void)sig;
+}
+
+void	setup_signals(void)
+{
+	struct sigaction	sa_int;
+	struct sigaction	sa_quit;
+
+	g_signal_received = 0;
+	rl_event_hook = check_signals_hook;
+	sigemptyset(&sa_int.sa_mask);
+	sa_int.sa_handler = handle_sigint;
+	sa_int.sa_flags = 0;
+	sigaction(SIGINT, &sa_int, NULL);
+	sigemptyset(&sa_quit.sa_mask);
+	sa_quit.sa_handler = SIG_IGN;
+	sa_quit.sa_flags = 0;
+	sigaction(SIGQUIT, &sa_quit, NULL);
+}
+
+void	setup_child_signals(void)
+{
+	struct sigaction	sa;
+
+	sigemptyset(&sa.sa_mask);
+	sa.sa_handler = SIG_DFL;
+	sa.sa_flags = 0;
+	sigaction(SIGINT, &sa, NULL);
+	sigaction(SIGQUIT, &sa, NULL);
+}
@@ -732,6 +732,198 @@ else
     rm -f /tmp/test_var_redir
 fi
 
+echo
+echo "=== Command String and Script Mode ==="
+echo -n "Testing: -c runs its argument... "
+result=$(./minishell -c "echo from_c" 2>/dev/null)
+if [ "$result" = "from_c" ]; then
+    echo -e "${GREEN}PASS${NC}"
+    ((PASSED++))
+else
+    echo -e "${RED}FAIL${NC}"
+    echo "  Expected: 'from_c', Got: '$result'"
+    ((FAILED++))
+fi
+
+echo -n "Testing: -c exit status... "
+./minishell -c "exit 7" >/dev/null 2>&1
+actual_code=$?
+if [ "$actual_code" = "7" ]; then
+    echo -e "${GREEN}PASS${NC}"
+    ((PASSED++))
+else
+    echo -e "${RED}FAIL${NC}"
+    echo "  Expected exit code: '7', Got: '$actual_code'"
+    ((FAILED++))
+fi
+
+echo -n "Testing: -c without argument... "
+./minishell -c >/dev/null 2>&1
+actual_code=$?
+if [ "$actual_code" = "2" ]; then
+    echo -e "${GREEN}PASS${NC}"
+    ((PASSED++))
+else
+    echo -e "${RED}FAIL${NC}"
+    echo "  Expected exit code: '2', Got: '$actual_code'"
+    ((FAILED++))
+fi
+
+echo -n "Testing: script file... "
+printf 'echo first\necho second\nfalse\n' > /tmp/test_script_mode
+result=$(./minishell /tmp/test_script_mode 2>/dev/null)
+actual_code=$?
+result=$(echo "$result" | tail -n 1)
+if [ "$result" = "second" ] && [ "$actual_code" = "1" ]; then
+    echo -e "${GREEN}PASS${NC}"
+    ((PASSED++))
+else
+    echo -e "${RED}FAIL${NC}"
+    echo "  Expected: 'second' (exit 1), Got: '$result' (exit $actual_code)"
+    ((FAILED++))
+fi
+rm -f /tmp/test_script_mode
+
+echo -n "Testing: missing script file... "
+./minishell /tmp/minishell_no_such_script >/dev/null 2>&1
+actual_code=$?
+if [ "$actual_code" = "127" ]; then
+    echo -e "${GREEN}PASS${NC}"
+    ((PASSED++))
+else
+    echo -e "${RED}FAIL${NC}"
+    echo "  Expected exit code: '127', Got: '$actual_code'"
+    ((FAILED++))
+fi
+
+echo
+echo "=== Hash Builtin Tests ==="
+test_command "hash" "hash on an empty table"
+test_command $'ls > /dev/null\nhash | tail -n 1' "hash remembers a found command"
+test_command $'ls > /dev/null\nhash -r\nhash' "hash -r empties the table"
+test_exit_code "hash ls" "0" "hash a command in PATH"
+test_exit_code "hash minishell_no_such_cmd" "1" "hash a missing command"
+test_should_fail "hash minishell_no_such_cmd" "hash reports a missing command"
+
+echo
+echo "=== Background Jobs and wait ==="
+test_exit_code $'sh -c "exit 3" &\nwait $!' "3" "wait returns a background pid status"
+test_exit_code $'sh -c "exit 4" &\nwait %1' "4" "wait on a job spec"
+test_exit_code $'sh -c "exit 5" | sh -c "exit 6" &\nwait $!' "6" "wait on a background pipeline"
+test_exit_code $'sleep 0 &\nsleep 0 &\nwait' "0" "wait for every job"
+test_exit_code "wait 1" "127" "wait on a pid that is not a child"
+test_exit_code "wait %9" "127" "wait on a job that does not exist"
+test_exit_code "wait abc" "1" "wait on an invalid argument"
+test_command $'echo bg_out > /tmp/test_bg_out &\nwait\ncat /tmp/test_bg_out' "background builtin output"
+rm -f /tmp/test_bg_out
+test_should_fail "&" "lone ampersand"
+test_should_fail "   &" "ampersand after blanks"
+
+echo
+echo "=== Command Lists ==="
+test_command "echo first > /dev/null ; echo second" "sequence runs both sides"
+test_command "true && echo and_ran" "&& after success"
+test_command "false && echo skipped ; echo after" "&& after failure"
+test_command "false || echo or_ran" "|| after failure"
+test_command "true || echo skipped ; echo after" "|| after success"
+test_command "false || false || echo last" "chained ||"
+test_command "echo a | tr a b > /dev/null && echo c | tr c d" "pipelines joined by &&"
+test_command "echo 'a ; b' \"c && d\" 'e || f'" "quoted list operators"
+test_exit_code "false ; true" "0" "status of a sequence"
+test_exit_code "true ; false" "1" "status of the last pipeline"
+test_exit_code "true && false" "1" "status through &&"
+test_exit_code "false || true" "0" "status through ||"
+test_exit_code "false && true" "1" "status of a skipped &&"
+test_exit_code "echo ok ;" "0" "trailing semicolon"
+test_exit_code "echo first ; ls >" "2" "syntax error in a later pipeline"
+test_should_fail "echo first ; ls >" "redirect without target after ;"
+test_should_fail "false && ls >" "redirect without target after &&"
+test_should_fail "true || echo <" "redirect without target after ||"
+test_should_fail "echo a | ; echo b" "pipe before ;"
+test_should_fail "; echo a" "leading ;"
+test_should_fail "echo a && && echo b" "doubled &&"
+test_should_fail "echo a ||" "trailing ||"
+
+echo -n "Testing: a later syntax error runs nothing... "
+result=$({
+    echo "echo first_ran ; ls >"
+    echo "exit"
+} | ./minishell 2>/dev/null | grep -c "^first_ran$")
+if [ "$result" = "0" ]; then
+    echo -e "${GREEN}PASS${NC}"
+    ((PASSED++))
+else
+    echo -e "${RED}FAIL${NC}"
+    echo "  Command: echo first_ran ; ls >"
+    ((FAILED++))
+fi
+
+echo
+echo "=== History Persistence ==="
+if command -v script >/dev/null 2>&1; then
+    rm -f /tmp/test_histfile
+    printf 'echo persisted_one\necho persisted_two\nexit\n' | \
+        HISTFILE=/tmp/test_histfile script -qc ./minishell /dev/null >/dev/null 2>&1
+
+    echo -n "Testing: history is saved to HISTFILE... "
+    if [ "$(head -n 2 /tmp/test_histfile 2>/dev/null | tr '\n' ' ')" = "echo persisted_one echo persisted_two " ]; then
+        echo -e "${GREEN}PASS${NC}"
+        ((PASSED++))
+    else
+        echo -e "${RED}FAIL${NC}"
+        ((FAILED++))
+    fi
+
+    echo -n "Testing: history is loaded from HISTFILE... "
+    result=$(printf 'history\nexit\n' | \
+        HISTFILE=/tmp/test_histfile script -qc ./minishell /dev/null 2>/dev/null | \
+        tr -d '\r' | grep -c "  echo persisted_two$")
+    if [ "$result" = "1" ]; then
+        echo -e "${GREEN}PASS${NC}"
+        ((PASSED++))
+    else
+        echo -e "${RED}FAIL${NC}"
+        ((FAILED++))
+    fi
+
+    echo -n "Testing: HISTFILESIZE truncates the file... "
+    printf 'echo persisted_three\nexit\n' | \
+        HISTFILE=/tmp/test_histfile HISTFILESIZE=2 script -qc ./minishell /dev/null >/dev/null 2>&1
+    if [ "$(cat /tmp/test_histfile 2>/dev/null | tr '\n' ' ')" = "echo persisted_three exit " ]; then
+        echo -e "${GREEN}PASS${NC}"
+        ((PASSED++))
+    else
+        echo -e "${RED}FAIL${NC}"
+        ((FAILED++))
+    fi
+    rm -f /tmp/test_histfile
+else
+    echo -e "Testing: history persistence... ${YELLOW}SKIPPED${NC} (script not found)"
+fi
+
+echo
+echo "=== History Search ==="
+test_exit_code "history -S" "2" "history -S without text"
+test_exit_code "history -S a b" "2" "history -S with two words"
+test_exit_code "history -s text" "2" "history rejects -s"
+if command -v script >/dev/null 2>&1; then
+    echo -n "Testing: history -S lists matching entries... "
+    result=$(printf 'echo alpha_entry\necho beta_entry\nhistory -S alpha_entry\nexit\n' | \
+        HISTFILE=/tmp/test_histfile script -qc ./minishell /dev/null 2>/dev/null | \
+        tr -d '\r' | grep "  echo [a-z]*_entry$" | sed 's/.*  //')
+    if [ "$result" = "echo alpha_entry" ]; then
+        echo -e "${GREEN}PASS${NC}"
+        ((PASSED++))
+    else
+        echo -e "${RED}FAIL${NC}"
+        echo "  Expected: 'echo alpha_entry', Got: '$result'"
+        ((FAILED++))
+    fi
+    rm -f /tmp/test_histfile
+else
+    echo -e "Testing: history -S on a tty... ${YELLOW}SKIPPED${NC} (script not found)"
+fi
+
 echo
 echo "=== Cleanup Test Environment ==="
 echo -n "Cleaning up test files... "